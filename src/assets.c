@@ -0,0 +1,237 @@
+/*
+ * This file is generated by tools/mkassets.sh from the
+ * art in assets/ - do not edit it by hand.
+ *
+ * The sprites are stored pre-shifted for lcdDrawSprite and
+ * the font is stored the way round lcdPrintText writes it
+ * into the frame buffer (see lcd.c), the small font is
+ * stored without its blank columns for lcdPrintSmallText
+ * (with SMALL_TEXT_INDEX giving the offset and width of
+ * each character). The splash screen is compressed (see
+ * rle.c).
+ */
+
+volatile const unsigned char __attribute((__progmem__)) TEXT[]={
+	0x00, 0x06, 0x18, 0x68, 0x88, 0x68, 0x18, 0x06,   /*  A  */
+	0x00, 0x0c, 0x72, 0x92, 0x92, 0x92, 0x92, 0xfe,   /*  B  */
+	0x00, 0x44, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38,   /*  C  */
+	0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0xfe,   /*  D  */
+	0x00, 0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0xfe,   /*  E  */
+	0x00, 0x80, 0x90, 0x90, 0x90, 0x90, 0x90, 0xfe,   /*  F  */
+	0x00, 0x5c, 0x92, 0x92, 0x92, 0x82, 0x44, 0x38,   /*  G  */
+	0x00, 0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0xfe,   /*  H  */
+	0x00, 0x00, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x00,   /*  I  */
+	0x00, 0x80, 0x80, 0xfc, 0x82, 0x82, 0x82, 0x0c,   /*  J  */
+	0x00, 0x02, 0x84, 0x48, 0x30, 0x10, 0x08, 0xfe,   /*  K  */
+	0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfe,   /*  L  */
+	0x00, 0xfe, 0x40, 0x20, 0x10, 0x20, 0x40, 0xfe,   /*  M  */
+	0x00, 0xfe, 0x04, 0x08, 0x10, 0x20, 0x40, 0xfe,   /*  N  */
+	0x00, 0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38,   /*  O  */
+	0x00, 0x60, 0x90, 0x90, 0x90, 0x90, 0x90, 0xfe,   /*  P  */
+	0x00, 0x3a, 0x44, 0x8a, 0x82, 0x82, 0x44, 0x38,   /*  Q  */
+	0x00, 0x62, 0x94, 0x98, 0x90, 0x90, 0x90, 0xfe,   /*  R  */
+	0x00, 0x0c, 0x52, 0x92, 0x92, 0x92, 0x92, 0x64,   /*  S  */
+	0x00, 0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80,   /*  T  */
+	0x00, 0xfe, 0x02, 0x02, 0x02, 0x02, 0x04, 0xf8,   /*  U  */
+	0x00, 0xc0, 0x30, 0x0c, 0x02, 0x0c, 0x30, 0xc0,   /*  V  */
+	0x00, 0xfe, 0x0c, 0x30, 0x40, 0x30, 0x0c, 0xfe,   /*  W  */
+	0x00, 0x82, 0xc6, 0x28, 0x10, 0x28, 0xc6, 0x82,   /*  X  */
+	0x00, 0x80, 0x40, 0x20, 0x1e, 0x20, 0x40, 0x80,   /*  Y  */
+	0x00, 0x82, 0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x82,   /*  Z  */
+	0x00, 0x02, 0x1e, 0x2a, 0x2a, 0x2a, 0x04, 0x00,   /*  a  */
+	0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0xfe, 0x00,   /*  b  */
+	0x00, 0x14, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x00,   /*  c  */
+	0x00, 0xfe, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00,   /*  d  */
+	0x00, 0x1a, 0x2a, 0x2a, 0x2a, 0x2a, 0x1c, 0x00,   /*  e  */
+	0x00, 0x50, 0x90, 0x90, 0x7e, 0x10, 0x10, 0x00,   /*  f  */
+	0x00, 0x3e, 0x25, 0x25, 0x25, 0x25, 0x19, 0x00,   /*  g  */
+	0x00, 0x00, 0x0e, 0x10, 0x10, 0x10, 0xfe, 0x00,   /*  h  */
+	0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,   /*  i  */
+	0x00, 0x00, 0x00, 0x5e, 0x01, 0x01, 0x00, 0x00,   /*  j  */
+	0x00, 0x22, 0x22, 0x14, 0x14, 0x08, 0xfe, 0x00,   /*  k  */
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,   /*  l  */
+	0x00, 0x1e, 0x20, 0x20, 0x1e, 0x20, 0x20, 0x3e,   /*  m  */
+	0x00, 0x1e, 0x20, 0x20, 0x20, 0x3e, 0x00, 0x00,   /*  n  */
+	0x00, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x00,   /*  o  */
+	0x00, 0x18, 0x24, 0x24, 0x24, 0x24, 0x3f, 0x00,   /*  p  */
+	0x00, 0x3f, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00,   /*  q  */
+	0x00, 0x20, 0x20, 0x20, 0x10, 0x08, 0x3e, 0x00,   /*  r  */
+	0x00, 0x04, 0x2a, 0x2a, 0x2a, 0x2a, 0x12, 0x00,   /*  s  */
+	0x00, 0x00, 0x22, 0x22, 0x7c, 0x20, 0x20, 0x00,   /*  t  */
+	0x00, 0x00, 0x3e, 0x02, 0x02, 0x02, 0x3c, 0x00,   /*  u  */
+	0x00, 0x00, 0x38, 0x04, 0x02, 0x04, 0x38, 0x00,   /*  v  */
+	0x00, 0x3c, 0x02, 0x04, 0x18, 0x04, 0x02, 0x3c,   /*  w  */
+	0x00, 0x02, 0x22, 0x14, 0x08, 0x14, 0x22, 0x20,   /*  x  */
+	0x00, 0x00, 0x3e, 0x05, 0x05, 0x05, 0x39, 0x00,   /*  y  */
+	0x00, 0x22, 0x32, 0x2a, 0x2a, 0x26, 0x22, 0x00,   /*  z  */
+	0x00, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x00    /*  .  */
+};
+
+volatile const unsigned char __attribute((__progmem__)) SMALL_TEXT[]={
+	0x00, 0x00, 0x00,   /*     */
+	0xfa,   /*  !  */
+	0xc0, 0x00, 0xc0,   /*  "  */
+	0x28, 0xfe, 0x28, 0xfe, 0x28,   /*  #  */
+	0x24, 0x54, 0xfe, 0x54, 0x48,   /*  $  */
+	0xc4, 0xc8, 0x10, 0x26, 0x46,   /*  %  */
+	0x6c, 0x92, 0xaa, 0x44, 0x0a,   /*  &  */
+	0xc0,   /*  '  */
+	0x38, 0x44, 0x82,   /*  (  */
+	0x82, 0x44, 0x38,   /*  )  */
+	0x28, 0x10, 0x7c, 0x10, 0x28,   /*  *  */
+	0x10, 0x10, 0x7c, 0x10, 0x10,   /*  +  */
+	0x0a, 0x0c,   /*  ,  */
+	0x10, 0x10, 0x10, 0x10, 0x10,   /*  -  */
+	0x06, 0x06,   /*  .  */
+	0x04, 0x08, 0x10, 0x20, 0x40,   /*  /  */
+	0x7c, 0x8a, 0x92, 0xa2, 0x7c,   /*  0  */
+	0x42, 0xfe, 0x02,   /*  1  */
+	0x42, 0x86, 0x8a, 0x92, 0x62,   /*  2  */
+	0x84, 0x82, 0xa2, 0xd2, 0x8c,   /*  3  */
+	0x18, 0x28, 0x48, 0xfe, 0x08,   /*  4  */
+	0xe4, 0xa2, 0xa2, 0xa2, 0x9c,   /*  5  */
+	0x3c, 0x52, 0x92, 0x92, 0x0c,   /*  6  */
+	0x80, 0x8e, 0x90, 0xa0, 0xc0,   /*  7  */
+	0x6c, 0x92, 0x92, 0x92, 0x6c,   /*  8  */
+	0x60, 0x92, 0x92, 0x94, 0x78,   /*  9  */
+	0x6c, 0x6c,   /*  :  */
+	0x6a, 0x6c,   /*  ;  */
+	0x10, 0x28, 0x44, 0x82,   /*  <  */
+	0x28, 0x28, 0x28, 0x28, 0x28,   /*  =  */
+	0x82, 0x44, 0x28, 0x10,   /*  >  */
+	0x40, 0x80, 0x8a, 0x90, 0x60,   /*  ?  */
+	0x4c, 0x92, 0x9e, 0x82, 0x7c,   /*  @  */
+	0x7e, 0x90, 0x90, 0x90, 0x7e,   /*  A  */
+	0xfe, 0x92, 0x92, 0x92, 0x6c,   /*  B  */
+	0x7c, 0x82, 0x82, 0x82, 0x44,   /*  C  */
+	0xfe, 0x82, 0x82, 0x44, 0x38,   /*  D  */
+	0xfe, 0x92, 0x92, 0x92, 0x82,   /*  E  */
+	0xfe, 0x90, 0x90, 0x90, 0x80,   /*  F  */
+	0x7c, 0x82, 0x92, 0x92, 0x5e,   /*  G  */
+	0xfe, 0x10, 0x10, 0x10, 0xfe,   /*  H  */
+	0x82, 0xfe, 0x82,   /*  I  */
+	0x04, 0x02, 0x82, 0xfc, 0x80,   /*  J  */
+	0xfe, 0x10, 0x28, 0x44, 0x82,   /*  K  */
+	0xfe, 0x02, 0x02, 0x02, 0x02,   /*  L  */
+	0xfe, 0x40, 0x30, 0x40, 0xfe,   /*  M  */
+	0xfe, 0x20, 0x10, 0x08, 0xfe,   /*  N  */
+	0x7c, 0x82, 0x82, 0x82, 0x7c,   /*  O  */
+	0xfe, 0x90, 0x90, 0x90, 0x60,   /*  P  */
+	0x7c, 0x82, 0x8a, 0x84, 0x7a,   /*  Q  */
+	0xfe, 0x90, 0x98, 0x94, 0x62,   /*  R  */
+	0x62, 0x92, 0x92, 0x92, 0x8c,   /*  S  */
+	0x80, 0x80, 0xfe, 0x80, 0x80,   /*  T  */
+	0xfc, 0x02, 0x02, 0x02, 0xfc,   /*  U  */
+	0xf8, 0x04, 0x02, 0x04, 0xf8,   /*  V  */
+	0xfc, 0x02, 0x1c, 0x02, 0xfc,   /*  W  */
+	0xc6, 0x28, 0x10, 0x28, 0xc6,   /*  X  */
+	0xc0, 0x20, 0x1e, 0x20, 0xc0,   /*  Y  */
+	0x86, 0x8a, 0x92, 0xa2, 0xc2,   /*  Z  */
+	0xfe, 0x82, 0x82,   /*  [  */
+	0x40, 0x20, 0x10, 0x08, 0x04,   /*  \  */
+	0x82, 0x82, 0xfe,   /*  ]  */
+	0x20, 0x40, 0x80, 0x40, 0x20,   /*  ^  */
+	0x02, 0x02, 0x02, 0x02, 0x02,   /*  _  */
+	0x80, 0x40,   /*  `  */
+	0x04, 0x2a, 0x2a, 0x2a, 0x1e,   /*  a  */
+	0xfe, 0x12, 0x22, 0x22, 0x1c,   /*  b  */
+	0x1c, 0x22, 0x22, 0x22, 0x04,   /*  c  */
+	0x1c, 0x22, 0x22, 0x12, 0xfe,   /*  d  */
+	0x1c, 0x2a, 0x2a, 0x2a, 0x18,   /*  e  */
+	0x10, 0x7e, 0x90, 0x80, 0x40,   /*  f  */
+	0x30, 0x4a, 0x4a, 0x4a, 0x7c,   /*  g  */
+	0xfe, 0x10, 0x20, 0x20, 0x1e,   /*  h  */
+	0x22, 0xbe, 0x02,   /*  i  */
+	0x04, 0x02, 0x22, 0xbc,   /*  j  */
+	0xfe, 0x08, 0x14, 0x22,   /*  k  */
+	0x82, 0xfe, 0x02,   /*  l  */
+	0x3e, 0x20, 0x18, 0x20, 0x1e,   /*  m  */
+	0x3e, 0x10, 0x20, 0x20, 0x1e,   /*  n  */
+	0x1c, 0x22, 0x22, 0x22, 0x1c,   /*  o  */
+	0x3e, 0x28, 0x28, 0x28, 0x10,   /*  p  */
+	0x10, 0x28, 0x28, 0x18, 0x3e,   /*  q  */
+	0x3e, 0x10, 0x20, 0x20, 0x10,   /*  r  */
+	0x12, 0x2a, 0x2a, 0x2a, 0x04,   /*  s  */
+	0x20, 0xfc, 0x22, 0x02, 0x04,   /*  t  */
+	0x3c, 0x02, 0x02, 0x04, 0x3e,   /*  u  */
+	0x38, 0x04, 0x02, 0x04, 0x38,   /*  v  */
+	0x3c, 0x02, 0x0c, 0x02, 0x3c,   /*  w  */
+	0x22, 0x14, 0x08, 0x14, 0x22,   /*  x  */
+	0x30, 0x0a, 0x0a, 0x0a, 0x3c,   /*  y  */
+	0x22, 0x26, 0x2a, 0x32, 0x22,   /*  z  */
+	0x10, 0x6c, 0x82,   /*  {  */
+	0xfe,   /*  |  */
+	0x82, 0x6c, 0x10,   /*  }  */
+	0x10, 0x20, 0x10, 0x08, 0x10    /*  ~  */
+};
+
+volatile const unsigned short __attribute((__progmem__)) SMALL_TEXT_INDEX[]={
+	0x0003, 0x0019, 0x0023, 0x003d, 0x0065, 0x008d, 0x00b5, 0x00d9,
+	0x00e3, 0x00fb, 0x0115, 0x013d, 0x0162, 0x0175, 0x019a, 0x01ad,
+	0x01d5, 0x01fb, 0x0215, 0x023d, 0x0265, 0x028d, 0x02b5, 0x02dd,
+	0x0305, 0x032d, 0x0352, 0x0362, 0x0374, 0x0395, 0x03bc, 0x03dd,
+	0x0405, 0x042d, 0x0455, 0x047d, 0x04a5, 0x04cd, 0x04f5, 0x051d,
+	0x0545, 0x056b, 0x0585, 0x05ad, 0x05d5, 0x05fd, 0x0625, 0x064d,
+	0x0675, 0x069d, 0x06c5, 0x06ed, 0x0715, 0x073d, 0x0765, 0x078d,
+	0x07b5, 0x07dd, 0x0805, 0x082b, 0x0845, 0x086b, 0x0885, 0x08ad,
+	0x08d2, 0x08e5, 0x090d, 0x0935, 0x095d, 0x0985, 0x09ad, 0x09d5,
+	0x09fd, 0x0a23, 0x0a3c, 0x0a5c, 0x0a7b, 0x0a95, 0x0abd, 0x0ae5,
+	0x0b0d, 0x0b35, 0x0b5d, 0x0b85, 0x0bad, 0x0bd5, 0x0bfd, 0x0c25,
+	0x0c4d, 0x0c75, 0x0c9d, 0x0cc3, 0x0cd9, 0x0ce3, 0x0cfd
+};
+
+volatile const unsigned char __attribute((__progmem__)) ALIEN8[]={
+	0x04, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x7d, 0x00, 0x7e, 0x00, 0x35, 0x00, 0x1e, 0x00, 0x05, 0x00,
+	0x08, 0x00, 0x3a, 0x00, 0x6c, 0x00, 0xfa, 0x00, 0xfc, 0x00, 0x6a, 0x00, 0x3c, 0x00, 0x0a, 0x00,
+	0x10, 0x00, 0x74, 0x00, 0xd8, 0x00, 0xf4, 0x01, 0xf8, 0x01, 0xd4, 0x00, 0x78, 0x00, 0x14, 0x00,
+	0x20, 0x00, 0xe8, 0x00, 0xb0, 0x01, 0xe8, 0x03, 0xf0, 0x03, 0xa8, 0x01, 0xf0, 0x00, 0x28, 0x00,
+	0x40, 0x00, 0xd0, 0x01, 0x60, 0x03, 0xd0, 0x07, 0xe0, 0x07, 0x50, 0x03, 0xe0, 0x01, 0x50, 0x00,
+	0x80, 0x00, 0xa0, 0x03, 0xc0, 0x06, 0xa0, 0x0f, 0xc0, 0x0f, 0xa0, 0x06, 0xc0, 0x03, 0xa0, 0x00,
+	0x00, 0x01, 0x40, 0x07, 0x80, 0x0d, 0x40, 0x1f, 0x80, 0x1f, 0x40, 0x0d, 0x80, 0x07, 0x40, 0x01,
+	0x00, 0x02, 0x80, 0x0e, 0x00, 0x1b, 0x80, 0x3e, 0x00, 0x3f, 0x80, 0x1a, 0x00, 0x0f, 0x80, 0x02
+};
+
+volatile const unsigned char __attribute((__progmem__)) SHIP8[]={
+	0x0f, 0x00, 0x03, 0x00, 0x27, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x27, 0x00, 0x03, 0x00, 0x0f, 0x00,
+	0x1e, 0x00, 0x06, 0x00, 0x4e, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x4e, 0x00, 0x06, 0x00, 0x1e, 0x00,
+	0x3c, 0x00, 0x0c, 0x00, 0x9c, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x9c, 0x00, 0x0c, 0x00, 0x3c, 0x00,
+	0x78, 0x00, 0x18, 0x00, 0x38, 0x01, 0xf0, 0x03, 0xf0, 0x03, 0x38, 0x01, 0x18, 0x00, 0x78, 0x00,
+	0xf0, 0x00, 0x30, 0x00, 0x70, 0x02, 0xe0, 0x07, 0xe0, 0x07, 0x70, 0x02, 0x30, 0x00, 0xf0, 0x00,
+	0xe0, 0x01, 0x60, 0x00, 0xe0, 0x04, 0xc0, 0x0f, 0xc0, 0x0f, 0xe0, 0x04, 0x60, 0x00, 0xe0, 0x01,
+	0xc0, 0x03, 0xc0, 0x00, 0xc0, 0x09, 0x80, 0x1f, 0x80, 0x1f, 0xc0, 0x09, 0xc0, 0x00, 0xc0, 0x03,
+	0x80, 0x07, 0x80, 0x01, 0x80, 0x13, 0x00, 0x3f, 0x00, 0x3f, 0x80, 0x13, 0x80, 0x01, 0x80, 0x07
+};
+
+volatile const unsigned char __attribute((__progmem__)) SPLASH[]={
+	0x83, 0x11, 0xfc, 0xfb, 0x77, 0x2f, 0x1f, 0x3e, 0x7e, 0xbe, 0xdd, 0xed, 0xf5, 0xf3, 0xf3, 0xfb,
+	0xf9, 0x79, 0x3d, 0xdd, 0xc2, 0xed, 0x03, 0xdd, 0x3d, 0x79, 0xfb, 0xc2, 0xf3, 0x09, 0xe3, 0xcb,
+	0xbb, 0x7b, 0x7b, 0x3b, 0x9b, 0xcb, 0xe3, 0xf7, 0xa4, 0x01, 0x1f, 0x1f, 0x82, 0x00, 0x3f, 0x81,
+	0x00, 0x3f, 0x82, 0x01, 0x7f, 0x3f, 0x81, 0x01, 0x1f, 0x1f, 0x82, 0x00, 0x3f, 0x81, 0x01, 0x1f,
+	0x1f, 0x81, 0x01, 0x1f, 0x1f, 0x81, 0x01, 0x1f, 0x1f, 0x81, 0x01, 0x1f, 0x1f, 0x82, 0x04, 0x3f,
+	0xfb, 0xfb, 0x07, 0x0f, 0x84, 0x08, 0xf3, 0xe5, 0xed, 0x9c, 0x70, 0xe8, 0x0c, 0xf0, 0xfe, 0x82,
+	0x03, 0x7f, 0x3f, 0x3f, 0x7f, 0x80, 0xc3, 0xfc, 0x01, 0xf9, 0xf9, 0xc3, 0xf8, 0x81, 0x01, 0x7f,
+	0x7f, 0x81, 0x01, 0xfe, 0xf0, 0x40, 0x00, 0xf1, 0xa7, 0x01, 0x80, 0x80, 0x81, 0x01, 0xfe, 0xf8,
+	0x80, 0x02, 0xf7, 0xf8, 0xfe, 0x82, 0x04, 0xfe, 0xf7, 0xf7, 0xf8, 0xfc, 0x81, 0x01, 0xfe, 0xf8,
+	0x81, 0x01, 0x80, 0x80, 0x81, 0x01, 0x90, 0x90, 0x81, 0x01, 0xf0, 0xf0, 0x81, 0x01, 0xf8, 0xfc,
+	0x81, 0x01, 0xfe, 0xf8, 0x81, 0x01, 0xf0, 0xf0, 0x89, 0x04, 0x3e, 0xc0, 0xf1, 0xcf, 0x3f, 0x81,
+	0x03, 0xfe, 0xfd, 0xfc, 0xfe, 0x8b, 0x08, 0xfc, 0xfa, 0xf8, 0xfc, 0x7f, 0x3f, 0xef, 0xc0, 0x3f,
+	0xbf, 0x9e, 0x21, 0xc0, 0xdf, 0xbf, 0xa7, 0xaf, 0x97, 0x52, 0xc9, 0xb5, 0x7b, 0x7b, 0xb7, 0xcf,
+	0x0f, 0xcf, 0x9f, 0x1f, 0x9f, 0x9f, 0x5f, 0x5f, 0x4f, 0xcf, 0x8f, 0xb7, 0x73, 0x7b, 0x75, 0x88,
+	0xd3, 0xa7, 0xaf, 0xbc, 0xc3, 0xbf, 0x99, 0x04, 0x7f, 0x3f, 0x3f, 0x1b, 0x13, 0xc2, 0x03, 0x16,
+	0x07, 0x07, 0x06, 0x01, 0x07, 0x83, 0xc1, 0xc7, 0xe2, 0xe3, 0x75, 0x32, 0xd6, 0xd6, 0x32, 0x64,
+	0xe3, 0xce, 0xc5, 0x83, 0x03, 0x01, 0x02, 0xc2, 0x03, 0x04, 0x13, 0x1b, 0x1f, 0x1f, 0xbf, 0xbf,
+	0x99, 0x03, 0xfe, 0xfc, 0xf8, 0xf0, 0x42, 0x01, 0xe0, 0x10, 0x40, 0x01, 0x88, 0x06, 0x80, 0xc2,
+	0x0f, 0x00, 0x1f, 0xc5, 0xfe, 0xc3, 0x0f, 0x80, 0x01, 0x04, 0x08, 0x41, 0x03, 0x80, 0xe0, 0xf8,
+	0xfe, 0xbf, 0x9f, 0x00, 0xc0, 0x42, 0x06, 0x60, 0x80, 0xc0, 0x66, 0x04, 0x40, 0xc1, 0x40, 0x06,
+	0x08, 0xc5, 0xe7, 0x73, 0x41, 0x03, 0x07, 0x40, 0x01, 0x41, 0x48, 0x40, 0x02, 0xc1, 0xc4, 0x21,
+	0x41, 0x00, 0xc1, 0x9e, 0x04, 0x7f, 0x3f, 0x1f, 0x8f, 0x8f, 0xc2, 0xcf, 0x03, 0x0f, 0x0f, 0x9f,
+	0xdf, 0x80, 0x03, 0xdf, 0x1f, 0x0f, 0x8f, 0xc2, 0xcf, 0x02, 0x0f, 0x1f, 0x1f, 0x80, 0xc4, 0x3f,
+	0x00, 0x2f, 0xc2, 0x0f, 0x01, 0x2f, 0x3f, 0x80, 0x09, 0x3f, 0x1f, 0x0f, 0x8f, 0xcf, 0xcf, 0x8f,
+	0x0f, 0x1f, 0x7f, 0x81, 0x09, 0xcf, 0x8f, 0x8f, 0x0f, 0x0f, 0x4f, 0xcf, 0xcf, 0x8f, 0x8f, 0x8b,
+	0x06, 0xfc, 0xf8, 0xf0, 0xe1, 0xe0, 0xc0, 0xc0, 0xc3, 0x80, 0x00, 0x81, 0xc5, 0x80, 0x06, 0xc0,
+	0xc0, 0xe0, 0xe0, 0xf1, 0xf8, 0xfc, 0xa0, 0x04, 0xf8, 0xf0, 0xe0, 0xc3, 0xc7, 0xc2, 0xcf, 0x03,
+	0xc3, 0xe3, 0xe7, 0xef, 0x81, 0x08, 0xe3, 0xc1, 0xc1, 0xcd, 0xcc, 0xcc, 0xc6, 0xe6, 0xef, 0x81,
+	0x04, 0xfe, 0xfc, 0xf8, 0xf1, 0xe3, 0xc2, 0xc0, 0x01, 0xde, 0xfe, 0x80, 0x09, 0xf8, 0xe0, 0xc0,
+	0xc7, 0xcf, 0xcf, 0xc7, 0xc0, 0xe0, 0xf0, 0x81, 0x08, 0xef, 0xe3, 0xc3, 0xcf, 0xce, 0xcc, 0xc0,
+	0xe0, 0xe3, 0x83
+};
@@ -0,0 +1,86 @@
+/*
+  attract.c - this file keeps statistics on how long each
+  frame takes while the game is playing itself in attract mode
+  (see attractBot in main.c), so that every unit left idle
+  doubles as a long running test of how the real game performs
+  on its own hardware.
+
+  The time of each frame runs from the clearing of framebuffer
+  up until lcdRepaint returns, i.e. the delay between frames is
+  not counted. Frames taking longer than FRAME_BUDGET (see
+  gamedefs.h) are counted as over budget. The statistics are
+  printed over serial by attractReport whenever an attract mode
+  game ends.
+*/
+#include <WProgram.h>
+#include "uart.h"
+#include "attract.h"
+#include "gamedefs.h"
+
+static unsigned long frameStart;
+static unsigned long frameCount;
+static unsigned long frameTotal;
+static unsigned long frameMin;
+static unsigned long frameMax;
+static unsigned long frameOverruns;
+static uint8_t       frameSkip;
+
+void attractReset(void)
+{
+	frameCount    = 0;
+	frameTotal    = 0;
+	frameMin      = 0xffffffffUL;
+	frameMax      = 0;
+	frameOverruns = 0;
+
+	/* The frame in progress when attract mode starts took in
+	 * the whole wait on the game over screen, so is not counted */
+	frameSkip     = 1;
+}
+
+void attractFrameBegin(void)
+{
+	frameStart = micros();
+}
+
+void attractFrameEnd(void)
+{
+	unsigned long frameTime = micros() - frameStart;
+
+	if(frameSkip){
+		frameSkip = 0;
+		return;
+	}
+
+	frameCount ++;
+	frameTotal += frameTime;
+
+	if(frameTime < frameMin){
+		frameMin = frameTime;
+	}
+	if(frameTime > frameMax){
+		frameMax = frameTime;
+	}
+	if(frameTime > FRAME_BUDGET * 1000UL){
+		frameOverruns ++;
+	}
+}
+
+void attractReport(void)
+{
+	if(frameCount == 0){
+		return;
+	}
+
+	uartPrint("attract: ");
+	uartPrintNumber(frameCount);
+	uartPrint(" frames, min ");
+	uartPrintNumber(frameMin);
+	uartPrint("us, mean ");
+	uartPrintNumber(frameTotal / frameCount);
+	uartPrint("us, max ");
+	uartPrintNumber(frameMax);
+	uartPrint("us, ");
+	uartPrintNumber(frameOverruns);
+	uartPrint(" over budget\r\n");
+}
@@ -0,0 +1,11 @@
+#ifndef attracth
+#define attracth
+
+#define ATTRACT_IDLE_WAIT     10000UL /* milliseconds on the game over screen before the game plays itself */
+
+void attractReset(void);
+void attractFrameBegin(void);
+void attractFrameEnd(void);
+void attractReport(void);
+
+#endif
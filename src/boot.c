@@ -0,0 +1,66 @@
+/*
+  boot.c - this file is responsible for timing the start up
+  sequence, from reset up until the game's first frame has
+  been shown on the LCD, so we know how long players are left
+  waiting before they can play.
+
+  The times are taken with micros(), which starts counting when
+  init (in wiring.c) sets up timer 0 a few cycles after reset,
+  and are printed over serial by bootReport. Any time spent
+  deliberately waiting (such as holding up the splash screen)
+  is passed to bootSkip and taken off the times which follow,
+  so the report only shows what start up itself costs.
+*/
+#include <WProgram.h>
+#include <avr/pgmspace.h>
+#include "uart.h"
+#include "boot.h"
+
+static unsigned long bootTime[BOOT_PHASES];
+static unsigned long bootSkipped;
+
+volatile const char __attribute((__progmem__)) BOOT_NAME_INIT       [] = { "init"        };
+volatile const char __attribute((__progmem__)) BOOT_NAME_LCD_POWER  [] = { "lcd power"   };
+volatile const char __attribute((__progmem__)) BOOT_NAME_INPUT      [] = { "buttons"     };
+volatile const char __attribute((__progmem__)) BOOT_NAME_GAME       [] = { "game reset"  };
+volatile const char __attribute((__progmem__)) BOOT_NAME_LCD_ON     [] = { "lcd on"      };
+volatile const char __attribute((__progmem__)) BOOT_NAME_SPLASH     [] = { "splash"      };
+volatile const char __attribute((__progmem__)) BOOT_NAME_FIRST_FRAME[] = { "first frame" };
+
+/* The table of names is itself kept in program memory too, as
+ * any other constant table would be copied into SRAM at reset */
+static const char* const __attribute((__progmem__)) BOOT_NAMES[BOOT_PHASES] = {
+	(const char*)BOOT_NAME_INIT,
+	(const char*)BOOT_NAME_LCD_POWER,
+	(const char*)BOOT_NAME_INPUT,
+	(const char*)BOOT_NAME_GAME,
+	(const char*)BOOT_NAME_LCD_ON,
+	(const char*)BOOT_NAME_SPLASH,
+	(const char*)BOOT_NAME_FIRST_FRAME
+};
+
+void bootMark(uint8_t phase)
+{
+	bootTime[phase] = micros() - bootSkipped;
+}
+
+void bootSkip(unsigned long time)
+{
+	bootSkipped += time;
+}
+
+void bootReport(void)
+{
+	uint8_t i;
+
+	for(i=0; i<BOOT_PHASES; i++){
+		if(!bootTime[i]){
+			continue; /* never reached in this build */
+		}
+		uartPrint("boot: ");
+		uartPrint_P((const char*)pgm_read_word(&BOOT_NAMES[i]));
+		uartPrint(" done at ");
+		uartPrintNumber(bootTime[i]);
+		uartPrint("us\r\n");
+	}
+}
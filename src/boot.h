@@ -0,0 +1,21 @@
+#ifndef booth
+#define booth
+
+/* Points in the start up sequence which are timed, start up
+ * is over once the game's first frame is on the screen. The
+ * splash is only shown when building with SPLASH_HOLD defined,
+ * otherwise its phase is left out of the report. */
+#define BOOT_INIT         0
+#define BOOT_LCD_POWER    1
+#define BOOT_INPUT        2
+#define BOOT_GAME         3
+#define BOOT_LCD_ON       4
+#define BOOT_SPLASH       5
+#define BOOT_FIRST_FRAME  6
+#define BOOT_PHASES       7
+
+void bootMark(uint8_t phase);
+void bootSkip(unsigned long time);
+void bootReport(void);
+
+#endif
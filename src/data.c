@@ -1,331 +1,42 @@
 /*
  * In order to keep the other code files from
- * getting too messed up, the  look up  table
- * for the alphabet to be rendered as well as
- * the initial state of the frame buffer  are
- * stored in this file.
+ * getting too messed up, the frame buffer and
+ * the scripts the aliens follow  are  stored
+ * in this file (the sprites,  alphabet  and
+ * splash screen are generated into assets.c).
  */
+#include <avr/io.h>
+#include "gamedefs.h"
+#include "script.h"
 
-volatile const unsigned char __attribute((__progmem__)) TEXT[]={
-	/* upper case */
-	0x06, 0x18, 0x68, 0x88, 0x68, 0x18, 0x06, 0x00,   /*  A  */
-	0xfe, 0x92, 0x92, 0x92, 0x92, 0x72, 0x0c, 0x00,   /*  B  */
-	0x38, 0x44, 0x82, 0x82, 0x82, 0x82, 0x44, 0x00,   /*  C  */
-	0xfe, 0x82, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00,   /*  D  */
-	0xfe, 0x92, 0x92, 0x92, 0x92, 0x92, 0x82, 0x00,   /*  E  */
-	0xfe, 0x90, 0x90, 0x90, 0x90, 0x90, 0x80, 0x00,   /*  F  */
-	0x38, 0x44, 0x82, 0x92, 0x92, 0x92, 0x5c, 0x00,   /*  G  */
-	0xfe, 0x10, 0x10, 0x10, 0x10, 0x10, 0xfe, 0x00,   /*  H  */
-	0x00, 0x82, 0x82, 0xfe, 0x82, 0x82, 0x00, 0x00,   /*  I  */
-	0x0c, 0x82, 0x82, 0x82, 0xfc, 0x80, 0x80, 0x00,   /*  J  */
-	0xfe, 0x08, 0x10, 0x30, 0x48, 0x84, 0x02, 0x00,   /*  K  */
-	0xfe, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,   /*  L  */
-	0xfe, 0x40, 0x20, 0x10, 0x20, 0x40, 0xfe, 0x00,   /*  M  */
-	0xfe, 0x40, 0x20, 0x10, 0x08, 0x04, 0xfe, 0x00,   /*  N  */
-	0x38, 0x44, 0x82, 0x82, 0x82, 0x44, 0x38, 0x00,   /*  O  */
-	0xfe, 0x90, 0x90, 0x90, 0x90, 0x90, 0x60, 0x00,   /*  P  */
-	0x38, 0x44, 0x82, 0x82, 0x8a, 0x44, 0x3a, 0x00,   /*  Q  */
-	0xfe, 0x90, 0x90, 0x90, 0x98, 0x94, 0x62, 0x00,   /*  R  */
-	0x64, 0x92, 0x92, 0x92, 0x92, 0x52, 0x0c, 0x00,   /*  S  */
-	0x80, 0x80, 0x80, 0xfe, 0x80, 0x80, 0x80, 0x00,   /*  T  */
-	0xf8, 0x04, 0x02, 0x02, 0x02, 0x02, 0xfe, 0x00,   /*  U  */
-	0xc0, 0x30, 0x0c, 0x02, 0x0c, 0x30, 0xc0, 0x00,   /*  V  */
-	0xfe, 0x0c, 0x30, 0x40, 0x30, 0x0c, 0xfe, 0x00,   /*  W  */
-	0x82, 0xc6, 0x28, 0x10, 0x28, 0xc6, 0x82, 0x00,   /*  X  */
-	0x80, 0x40, 0x20, 0x1e, 0x20, 0x40, 0x80, 0x00,   /*  Y  */
-	0x82, 0x86, 0x8a, 0x92, 0xa2, 0xc2, 0x82, 0x00,   /*  Z  */
-
-	/* lower case */
-	0x00, 0x04, 0x2a, 0x2a, 0x2a, 0x1e, 0x02, 0x00,   /*  A  */
-	0x00, 0xfe, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00,   /*  B  */
-	0x00, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x14, 0x00,   /*  C  */
-	0x00, 0x0c, 0x12, 0x12, 0x12, 0x12, 0xfe, 0x00,   /*  D  */
-	0x00, 0x1c, 0x2a, 0x2a, 0x2a, 0x2a, 0x1a, 0x00,   /*  E  */
-	0x00, 0x10, 0x10, 0x7e, 0x90, 0x90, 0x50, 0x00,   /*  F  */
-	0x00, 0x19, 0x25, 0x25, 0x25, 0x25, 0x3e, 0x00,   /*  G  */
-	0x00, 0xfe, 0x10, 0x10, 0x10, 0x0e, 0x00, 0x00,   /*  H  */
-	0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x00,   /*  I  */
-	0x00, 0x00, 0x01, 0x01, 0x5e, 0x00, 0x00, 0x00,   /*  J  */
-	0x00, 0xfe, 0x08, 0x14, 0x14, 0x22, 0x22, 0x00,   /*  K  */
-	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,   /*  L  */
-	0x3e, 0x20, 0x20, 0x1e, 0x20, 0x20, 0x1e, 0x00,   /*  M  */
-	0x00, 0x00, 0x3e, 0x20, 0x20, 0x20, 0x1e, 0x00,   /*  N  */
-	0x00, 0x1c, 0x22, 0x22, 0x22, 0x22, 0x1c, 0x00,   /*  O  */
-	0x00, 0x3f, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00,   /*  P  */
-	0x00, 0x18, 0x24, 0x24, 0x24, 0x24, 0x3f, 0x00,   /*  Q  */
-	0x00, 0x3e, 0x08, 0x10, 0x20, 0x20, 0x20, 0x00,   /*  R  */
-	0x00, 0x12, 0x2a, 0x2a, 0x2a, 0x2a, 0x04, 0x00,   /*  S  */
-	0x00, 0x20, 0x20, 0x7c, 0x22, 0x22, 0x00, 0x00,   /*  T  */
-	0x00, 0x3c, 0x02, 0x02, 0x02, 0x3e, 0x00, 0x00,   /*  U  */
-	0x00, 0x38, 0x04, 0x02, 0x04, 0x38, 0x00, 0x00,   /*  V  */
-	0x3c, 0x02, 0x04, 0x18, 0x04, 0x02, 0x3c, 0x00,   /*  W  */
-	0x20, 0x22, 0x14, 0x08, 0x14, 0x22, 0x02, 0x00,   /*  X  */
-	0x00, 0x39, 0x05, 0x05, 0x05, 0x3e, 0x00, 0x00,   /*  Y  */
-	0x00, 0x22, 0x26, 0x2a, 0x2a, 0x32, 0x22, 0x00,   /*  Z  */
+/* The frame buffer itself starts out empty so it goes
+ * into .bss, which the C runtime simply zeroes at start
+ * up (as opposed to .data which has to be copied out of
+ * flash byte by byte). It is given an (all zero)
+ * initialiser regardless, as otherwise older compilers
+ * make it a 'common' symbol, which is left out of this
+ * file's .bss by size reports (see tools/sramreport.sh).
+ */
+volatile unsigned char framebuffer[1024] = { 0 };
 
-	0x00, 0x00, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x00    /*  .  */
+/* The aliens march from side to side, turning around,
+ * dropping down and speeding up whenever one of them
+ * reaches an edge of the screen (see script.h).
+ */
+volatile const unsigned char __attribute((__progmem__)) MARCH_SCRIPT[]={
+	/* 0 */ SCRIPT_SET_SPEED(ALIEN_START_SPEED),
+	/* 2 */ SCRIPT_BOUNCE(ALIEN_INCREASE_Y_BY, ALIEN_SPEED_UP_NUM, ALIEN_SPEED_UP_DEN),
+	/* 6 */ SCRIPT_MARCH(),
+	/* 7 */ SCRIPT_WAIT(1),
+	/* 9 */ SCRIPT_JUMP(2)
 };
 
-/* compiler needs to see some data defined here before
- * it will consider allocating the memory on the stack
- * - might be a bug
+/* One of the aliens fires every ENEMY_WAIT_BETWEEN_FIRE
+ * frames, this script is restarted when the player loses
+ * a life to give them a moment before the next shot.
  */
-volatile unsigned char framebuffer[1024]={
-		 0xff, 0xff, 0xff, 0xff,
-		 0xfc, 0xfb, 0x77, 0x2f,
-		 0x1f, 0x3e, 0x7e, 0xbe,
-		 0xdd, 0xed, 0xf5, 0xf3,
-		 0xf3, 0xfb, 0xf9, 0x79,
-		 0x3d, 0xdd, 0xed, 0xed,
-		 0xed, 0xdd, 0x3d, 0x79,
-		 0xfb, 0xf3, 0xf3, 0xf3,
-		 0xe3, 0xcb, 0xbb, 0x7b,
-		 0x7b, 0x3b, 0x9b, 0xcb,
-		 0xe3, 0xf7, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0x1f,
-		 0x1f, 0xff, 0xff, 0xff,
-		 0x3f, 0xff, 0xff, 0x3f,
-		 0xff, 0xff, 0xff, 0x7f,
-		 0x3f, 0xff, 0xff, 0x1f,
-		 0x1f, 0xff, 0xff, 0xff,
-		 0x3f, 0xff, 0xff, 0x1f,
-		 0x1f, 0xff, 0xff, 0x1f,
-		 0x1f, 0xff, 0xff, 0x1f,
-		 0x1f, 0xff, 0xff, 0x1f,
-		 0x1f, 0xff, 0xff, 0xff,
-		 0x3f, 0xfb, 0xfb, 0x07,
-		 0x0f, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xf3, 0xe5,
-		 0xed, 0x9c, 0x70, 0xe8,
-		 0x0c, 0xf0, 0xfe, 0xff,
-		 0xff, 0xff, 0x7f, 0x3f,
-		 0x3f, 0x7f, 0xff, 0xfc,
-		 0xfc, 0xfc, 0xfc, 0xf9,
-		 0xf9, 0xf8, 0xf8, 0xf8,
-		 0xf8, 0xff, 0xff, 0x7f,
-		 0x7f, 0xff, 0xff, 0xfe,
-		 0xf0, 0x00, 0xf1, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0x80,
-		 0x80, 0xff, 0xff, 0xfe,
-		 0xf8, 0xff, 0xf7, 0xf8,
-		 0xfe, 0xff, 0xff, 0xff,
-		 0xfe, 0xf7, 0xf7, 0xf8,
-		 0xfc, 0xff, 0xff, 0xfe,
-		 0xf8, 0xff, 0xff, 0x80,
-		 0x80, 0xff, 0xff, 0x90,
-		 0x90, 0xff, 0xff, 0xf0,
-		 0xf0, 0xff, 0xff, 0xf8,
-		 0xfc, 0xff, 0xff, 0xfe,
-		 0xf8, 0xff, 0xff, 0xf0,
-		 0xf0, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0x3e,
-		 0xc0, 0xf1, 0xcf, 0x3f,
-		 0xff, 0xff, 0xfe, 0xfd,
-		 0xfc, 0xfe, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xfc, 0xfa,
-		 0xf8, 0xfc, 0x7f, 0x3f,
-		 0xef, 0xc0, 0x3f, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xc0, 0xdf,
-		 0xbf, 0xa7, 0xaf, 0x97,
-		 0x52, 0xc9, 0xb5, 0x7b,
-		 0x7b, 0xb7, 0xcf, 0x0f,
-		 0xcf, 0x9f, 0x1f, 0x9f,
-		 0x9f, 0x5f, 0x5f, 0x4f,
-		 0xcf, 0x8f, 0xb7, 0x73,
-		 0x7b, 0x75, 0x88, 0xd3,
-		 0xa7, 0xaf, 0xbc, 0xc3,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0x7f, 0x3f,
-		 0x3f, 0x1b, 0x13, 0x03,
-		 0x03, 0x03, 0x07, 0x07,
-		 0x06, 0x01, 0x07, 0x83,
-		 0xc1, 0xc7, 0xe2, 0xe3,
-		 0x75, 0x32, 0xd6, 0xd6,
-		 0x32, 0x64, 0xe3, 0xce,
-		 0xc5, 0x83, 0x03, 0x01,
-		 0x02, 0x03, 0x03, 0x03,
-		 0x13, 0x1b, 0x1f, 0x1f,
-		 0xbf, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xfe,
-		 0xfc, 0xf8, 0xf0, 0x00,
-		 0x00, 0x00, 0xe0, 0x10,
-		 0x00, 0x88, 0x06, 0xff,
-		 0x0f, 0x0f, 0x0f, 0x1f,
-		 0xfe, 0xfe, 0xfe, 0xfe,
-		 0xfe, 0xfe, 0x0f, 0x0f,
-		 0x0f, 0x0f, 0xff, 0x04,
-		 0x08, 0x00, 0x00, 0x80,
-		 0xe0, 0xf8, 0xfe, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xc0,
-		 0x00, 0x00, 0x00, 0x60,
-		 0x80, 0xc0, 0x66, 0x04,
-		 0x40, 0xc1, 0x00, 0x08,
-		 0xc5, 0xe7, 0x73, 0x41,
-		 0x03, 0x07, 0x00, 0x41,
-		 0x48, 0x00, 0xc1, 0xc4,
-		 0x21, 0x00, 0x00, 0xc1,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0x7f,
-		 0x3f, 0x1f, 0x8f, 0x8f,
-		 0xcf, 0xcf, 0xcf, 0x0f,
-		 0x0f, 0x9f, 0xdf, 0xff,
-		 0xdf, 0x1f, 0x0f, 0x8f,
-		 0xcf, 0xcf, 0xcf, 0x0f,
-		 0x1f, 0x1f, 0xff, 0x3f,
-		 0x3f, 0x3f, 0x3f, 0x3f,
-		 0x2f, 0x0f, 0x0f, 0x0f,
-		 0x2f, 0x3f, 0xff, 0x3f,
-		 0x1f, 0x0f, 0x8f, 0xcf,
-		 0xcf, 0x8f, 0x0f, 0x1f,
-		 0x7f, 0xff, 0xff, 0xcf,
-		 0x8f, 0x8f, 0x0f, 0x0f,
-		 0x4f, 0xcf, 0xcf, 0x8f,
-		 0x8f, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xfc, 0xf8, 0xf0,
-		 0xe1, 0xe0, 0xc0, 0xc0,
-		 0x80, 0x80, 0x80, 0x80,
-		 0x81, 0x80, 0x80, 0x80,
-		 0x80, 0x80, 0x80, 0xc0,
-		 0xc0, 0xe0, 0xe0, 0xf1,
-		 0xf8, 0xfc, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xff,
-		 0xff, 0xff, 0xff, 0xf8,
-		 0xf0, 0xe0, 0xc3, 0xc7,
-		 0xcf, 0xcf, 0xcf, 0xc3,
-		 0xe3, 0xe7, 0xef, 0xff,
-		 0xff, 0xe3, 0xc1, 0xc1,
-		 0xcd, 0xcc, 0xcc, 0xc6,
-		 0xe6, 0xef, 0xff, 0xff,
-		 0xfe, 0xfc, 0xf8, 0xf1,
-		 0xe3, 0xc0, 0xc0, 0xc0,
-		 0xde, 0xfe, 0xff, 0xf8,
-		 0xe0, 0xc0, 0xc7, 0xcf,
-		 0xcf, 0xc7, 0xc0, 0xe0,
-		 0xf0, 0xff, 0xff, 0xef,
-		 0xe3, 0xc3, 0xcf, 0xce,
-		 0xcc, 0xc0, 0xe0, 0xe3,
-		 0xff, 0xff, 0xff, 0xff};
-
-
+volatile const unsigned char __attribute((__progmem__)) FIRE_SCRIPT[]={
+	/* 0 */ SCRIPT_WAIT(ENEMY_WAIT_BETWEEN_FIRE),
+	/* 2 */ SCRIPT_FIRE(),
+	/* 3 */ SCRIPT_JUMP(0)
+};
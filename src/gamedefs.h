@@ -1,33 +1,80 @@
 #ifndef gamedefsh
 #define gamedefsh
 
-#define SCREEN_WIDTH             128
-#define SCREEN_HEIGHT            64
-#define ALIEN_WIDTH              8
-#define ALIEN_HEIGHT             8
-#define SHIP_WIDTH               8
-#define SHIP_HEIGHT              8
-#define SHIP_X_MOVE              2
-#define ENEMY_WAIT_BETWEEN_FIRE  5
-#define PLAYER_WAIT_BETWEEN_FIRE 10
-#define ROW1_ENEMY_COUNT         5
-#define ROW2_ENEMY_COUNT         4
-#define ENEMY_BULLET_SPEED       1
-#define SHIP_BULL_SPEED          1
-#define ALIEN_BETWEEN_OFFSET     18
-#define ALIEN_INCREASE_SPEED_BY  1.2f
-#define ALIEN_INCREASE_Y_BY      4
-#define PLAYER_POINTS_PER_ALIEN  2
-#define MAX_PLAYER_BULLETS       20
-#define MAX_ENEMY_BULLETS        20
-#define ENEMY_COUNT              (ROW1_ENEMY_COUNT + ROW2_ENEMY_COUNT) /* this should be a constant, but the compiler seems to be fine with this - presumably the compiler has inlined the addition anyway */
+/*
+ * The game's configuration is given as enumeration constants
+ * rather than as #defines. Either way they are constants known
+ * when compiling, but these are seen by the compiler itself
+ * rather than pasted in as text: each is an int, those worked
+ * out from the others (such as ENEMY_COUNT) are worked out
+ * once rather than wherever they are used (so need no extra
+ * brackets), they keep to C's rules of scope and they can be
+ * looked up by name in a debugger. The checks at the bottom
+ * of this file are made on these values.
+ */
+enum {
+	SCREEN_WIDTH             = 128,
+	SCREEN_HEIGHT            = 64,
+	ALIEN_WIDTH              = 8,
+	ALIEN_HEIGHT             = 8,
+	SHIP_WIDTH               = 8,
+	SHIP_HEIGHT              = 8,
+	SHIP_X_MOVE              = 2,
+	ENEMY_WAIT_BETWEEN_FIRE  = 5,
+	PLAYER_WAIT_BETWEEN_FIRE = 10,
+	ROW1_ENEMY_COUNT         = 5,
+	ROW2_ENEMY_COUNT         = 4,
+	ENEMY_BULLET_SPEED       = 1,
+	SHIP_BULL_SPEED          = 1,
+	ALIEN_BETWEEN_OFFSET     = 18,
+	ALIEN_SPEED_UP_NUM       = 6, /* i.e. the aliens speed up by 6/5 = 1.2 times */
+	ALIEN_SPEED_UP_DEN       = 5,
+	ALIEN_START_SPEED        = 4, /* in 1/8 pixels per frame */
+	ALIEN_INCREASE_Y_BY      = 4,
+	PLAYER_POINTS_PER_ALIEN  = 2,
+	MAX_PLAYER_BULLETS       = 20,
+	MAX_ENEMY_BULLETS        = 20,
+	SPLASH_TIME              = 2000, /* milliseconds the splash is held, with SPLASH_HOLD */
+	ENEMY_COUNT              = ROW1_ENEMY_COUNT + ROW2_ENEMY_COUNT
+};
 
-#define ALIVE                    7 /* may be any non negative non multiple of 2 */
-#define START_DYING              (ALIVE - 1)
-#define DEAD                     0 /* should always be 0 */
+/*
+ * FRAME_BUDGET is the longest the work of a frame (clearing,
+ * updating and repainting) should take. The main loop pauses for
+ * 50ms after each frame, and for as long as the work takes no
+ * longer than that pause it is the pause which mostly sets the
+ * frame rate - past it, the game drops below 10 frames a second
+ * and visibly slows. Frames over budget are counted in attract
+ * mode (see attract.c) and can be found with trace.c.
+ */
+enum {
+	FRAME_BUDGET             = 50    /* milliseconds */
+};
 
-#define BUTTON_USER_LEFT         0
-#define BUTTON_USER_RIGHT        1
-#define BUTTON_USER_FIRE         2
+enum {
+	ALIVE                    = 7, /* may be any non negative non multiple of 2 */
+	START_DYING              = ALIVE - 1,
+	DEAD                     = 0  /* should always be 0 */
+};
+
+enum {
+	BUTTON_USER_LEFT         = 0,
+	BUTTON_USER_RIGHT        = 1,
+	BUTTON_USER_FIRE         = 2
+};
+
+/*
+ * The game logic makes a few assumptions about the values
+ * above, these are checked here so that changing one of them
+ * to something unworkable stops the build rather than
+ * breaking the game (a negative array size is an error).
+ */
+#define GAME_ASSERT(name, test) typedef char name[(test) ? 1 : -1]
+
+GAME_ASSERT(aliveMustBeOdd,        ALIVE % 2 == 1);
+GAME_ASSERT(bulletsFitIn8Bits,     MAX_PLAYER_BULLETS < 256 && MAX_ENEMY_BULLETS < 256);
+GAME_ASSERT(enemiesFitIn8Bits,     ENEMY_COUNT < 255); /* see enemyRemaining in main.c */
+GAME_ASSERT(rowsFitOnScreen,       (ROW1_ENEMY_COUNT - 1) * ALIEN_BETWEEN_OFFSET + ALIEN_WIDTH < SCREEN_WIDTH);
+GAME_ASSERT(speedUpFitsInAByte,    ALIEN_SPEED_UP_NUM < 256 && ALIEN_SPEED_UP_DEN < 256 && ALIEN_SPEED_UP_DEN > 0);
 
 #endif
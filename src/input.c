@@ -7,10 +7,12 @@
   listed:
 
   C3, C4 and C5 correspond to button 0, 1 and 2 respectively.
+  (these are set in pins.h and may be changed there)
 
   Author: Group 10 (Michael Nolan)
 */
 #include <avr/io.h>
+#include "pins.h"
 
 void initButtons(void)
 {
@@ -21,9 +23,12 @@ void initButtons(void)
 	 * as
 	 *   DDRC &=  0xC7;
 	 * but in the way it stands it is much easier
-	 * to read and understand.
+	 * to read and understand (and the buttons need
+	 * not share a port).
 	 */
-	DDRC &= ~((1 << 3)|(1 << 4)|(1 << 5));
+	pinInput(BUTTON0);
+	pinInput(BUTTON1);
+	pinInput(BUTTON2);
 }
 
 int isButtonDown(int buttonId)
@@ -31,12 +36,16 @@ int isButtonDown(int buttonId)
 	/* Here we simply check if any pin goes low
 	 * (we are using pullup resistors on each
 	 * switch and thus keeping them high until
-	 * depressed).
+	 * depressed). Each button is tested
+	 * separately, as the pin must be known when
+	 * compiling for this to be a single instruction.
 	 */
-	if(buttonId > 3){
-		return 0x00;
+	switch(buttonId){
+		case 0: return !pinRead(BUTTON0);
+		case 1: return !pinRead(BUTTON1);
+		case 2: return !pinRead(BUTTON2);
 	}
-	return !(PINC & (1 << (3 + buttonId)));
+	return 0x00;
 }
 
 int isAnyKeyDown(void)
@@ -45,5 +54,5 @@ int isAnyKeyDown(void)
 	 * are depressed - quite useful in our gaming logic.
 	 *
 	 */
-	return !((PINC & 0b00111000) == 0b00111000);
+	return !(pinRead(BUTTON0) && pinRead(BUTTON1) && pinRead(BUTTON2));
 }
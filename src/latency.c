@@ -0,0 +1,120 @@
+/*
+  latency.c - this file keeps histograms of how long the timer 0
+  overflow interrupt (which keeps millis and micros going, see
+  wiring.c) is kept waiting and how long it runs for, and of how
+  long each strobe of the LCD's enable line actually lasts - an
+  interrupt landing in the middle of a strobe stretches it. This
+  tells us how much room is left before adding more interrupts.
+
+  To use it, define LATENCY_STATS for every file (wiring.c
+  included) and call latencyInit after init.
+
+  Three histograms are kept, each of LATENCY_BUCKETS buckets
+  with the last one also counting anything longer:
+
+    entry   - timer 0's count on entering the interrupt, i.e.
+              how long after the overflow the interrupt got to
+              run, in 4us steps (timer 0's own resolution)
+    length  - how long the interrupt ran for, in 1us steps,
+              taken with timer 2 which we take over and run with
+              no prescaler (this includes the time spent in
+              these functions, but not the interrupt's own
+              saving and restoring of registers)
+    pulse   - how long each enable strobe lasted, in 1us steps,
+              taken the same way with timer 3 (a strobe is meant
+              to last about 1us, see lcdEnable)
+
+  Timers 2 and 3 are otherwise only used for PWM, which we do not
+  use. The two are kept apart as the interrupt and the main loop
+  must never share a 16-bit timer - reading one goes through a
+  temporary register an interrupt may overwrite.
+
+  The histograms are printed over serial by latencyDump.
+*/
+#ifdef LATENCY_STATS
+
+#include <avr/io.h>
+#include "uart.h"
+#include "latency.h"
+
+#define LATENCY_BUCKETS 16
+
+static uint16_t entryCounts [LATENCY_BUCKETS];
+static uint16_t lengthCounts[LATENCY_BUCKETS];
+static uint16_t pulseCounts [LATENCY_BUCKETS];
+static uint8_t  isrStart;
+static uint16_t pulseStart;
+
+/* Adds one to bucket (or the last bucket), stopping at the most
+ * a count can hold rather than wrapping round to 0 */
+static void latencyCount(uint16_t* counts, uint16_t bucket)
+{
+	if(bucket >= LATENCY_BUCKETS){
+		bucket = LATENCY_BUCKETS - 1;
+	}
+	if(counts[bucket] != 0xffff){
+		counts[bucket]++;
+	}
+}
+
+void latencyInit(void)
+{
+	/* Both timers count CPU cycles, in normal mode */
+	TCCR2A = 0;
+	TCCR2B = (1 << CS20);
+	TCCR3A = 0;
+	TCCR3B = (1 << CS30);
+}
+
+void latencyIsrEnter(void)
+{
+	isrStart = TCNT2;
+	latencyCount(entryCounts, TCNT0);
+}
+
+void latencyIsrExit(void)
+{
+	/* The interrupt is well under 256 cycles long, so the
+	 * 8-bit difference cannot wrap */
+	latencyCount(lengthCounts, (uint8_t)(TCNT2 - isrStart) >> 4);
+}
+
+void latencyPulseBegin(void)
+{
+	pulseStart = TCNT3;
+}
+
+void latencyPulseEnd(void)
+{
+	latencyCount(pulseCounts, (uint16_t)(TCNT3 - pulseStart) >> 4);
+}
+
+static void latencyDumpCounts(const char* name, uint16_t* counts, uint8_t step)
+{
+	uint8_t i;
+
+	for(i=0; i<LATENCY_BUCKETS; i++){
+		if(counts[i] == 0){
+			continue;
+		}
+		uartPrint_P(name);
+		uartPrint(" ");
+		uartPrintNumber(i * step);
+		uartPrint(i == LATENCY_BUCKETS - 1 ? "us+ " : "us ");
+		uartPrintNumber(counts[i]);
+		uartPrint("\r\n");
+	}
+}
+
+volatile const char __attribute((__progmem__)) LATENCY_NAME_ENTRY [] = { "isr entry"  };
+volatile const char __attribute((__progmem__)) LATENCY_NAME_LENGTH[] = { "isr length" };
+volatile const char __attribute((__progmem__)) LATENCY_NAME_PULSE [] = { "lcd pulse"  };
+
+void latencyDump(void)
+{
+	latencyDumpCounts((const char*)LATENCY_NAME_ENTRY,  entryCounts,  4);
+	latencyDumpCounts((const char*)LATENCY_NAME_LENGTH, lengthCounts, 1);
+	latencyDumpCounts((const char*)LATENCY_NAME_PULSE,  pulseCounts,  1);
+}
+
+#endif
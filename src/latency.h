@@ -0,0 +1,24 @@
+#ifndef latencyh
+#define latencyh
+
+/*
+ * The interrupt latency statistics only exist when building with
+ * LATENCY_STATS defined, otherwise these calls vanish.
+ */
+#ifdef LATENCY_STATS
+void latencyInit(void);
+void latencyIsrEnter(void);
+void latencyIsrExit(void);
+void latencyPulseBegin(void);
+void latencyPulseEnd(void);
+void latencyDump(void);
+#else
+#define latencyInit()
+#define latencyIsrEnter()
+#define latencyIsrExit()
+#define latencyPulseBegin()
+#define latencyPulseEnd()
+#define latencyDump()
+#endif
+
+#endif
@@ -12,6 +12,9 @@
   Pin B1 is used as the LCD chip select pin (i.e. the
    LCD's enable pin, or the strobe pin depending on
    the context)
+  Pin B0 selects between register and pixel commands
+
+  (these are set in pins.h and may be changed there)
 
   Note that the protocol interface implemented here is
   based on the specification outlined by
@@ -27,6 +30,10 @@
 #include <WProgram.h>
 #include <avr/pgmspace.h>
 #include "lcd.h"
+#include "pins.h"
+#include "rle.h"
+#include "trace.h"
+#include "latency.h"
 
 /* Global variables
  *  Although these are defined in data.c
@@ -55,18 +62,32 @@
  * have exchanged the assembly instructions for
  * more readable c-code.
  *
- * Also note that 'TEXT' is an array of upper and lower case
+ * Also note that 'TEXT' (and 'SMALL_TEXT') is an array of upper and lower case
  * character bitmaps to be used by the lcdPrintText function
  * (as this LCD does not come pre-loaded with this data unlike
  * most text-based LCDs will do so they must be implemented by
  * the MCU).
  *
+ * 'SPLASH' is the start up image, stored compressed but
+ * otherwise in the same page by 128 layout as framebuffer
+ * (see lcdShowSplash).
+ *
  */
 extern volatile       unsigned char                              framebuffer[];
 extern volatile const unsigned char __attribute__((__progmem__)) TEXT[];
+extern volatile const unsigned char  __attribute__((__progmem__)) SMALL_TEXT[];
+extern volatile const unsigned short __attribute__((__progmem__)) SMALL_TEXT_INDEX[];
+extern volatile const unsigned char __attribute__((__progmem__)) SPLASH[];
+
+/*
+ * Everything from here to lcdShowSplash talks to the KS0108
+ * LCD itself, building with LCD_SSD1306 defined uses the
+ * versions in oled.c instead.
+ */
+#ifndef LCD_SSD1306
 
-/* Static prototypes */
-static void lcdEnableSlow(void);
+/* The time (in milliseconds) the LCD was powered up, see lcdTurnOn */
+static unsigned long lcdPowerOnTime;
 
 /* LCD specification specific commands */
 #define ON                    1
@@ -74,18 +95,18 @@ static void lcdEnableSlow(void);
 #define LCD_TURN_ONOFF_CMD(x) (0b00111110 | ( x & 0b1   ))
 #define LCD_GOTO_ROW(x)       (0b10111000 | ( x & 0b111 ))
 #define LCD_GOTO_ORG()        (0b01000000                )
-#define LCD_PIXEL_CMD()       {PORTB |=  (1<<0);}
-#define LCD_REGISTER_CMD()    {PORTB &= ~(1<<0);}
+#define LCD_PIXEL_CMD()       pinHigh(LCD_RS)
+#define LCD_REGISTER_CMD()    pinLow(LCD_RS)
 
 /* Macros */
-#define ICOFF()            { PORTC |=  (1<<0); PORTC |=  (1<<1); }
-#define IC1()              { PORTC |=  (1<<0); PORTC &= ~(1<<1); }
-#define IC2()              { PORTC &= ~(1<<0); PORTC |=  (1<<1); }
+#define ICOFF()            { pinHigh(LCD_CS1); pinHigh(LCD_CS2); }
+#define IC1()              { pinHigh(LCD_CS2); pinLow(LCD_CS1);  }
+#define IC2()              { pinLow(LCD_CS2);  pinHigh(LCD_CS1); }
 #define VERY_SHORT_DELAY() { delayMicroseconds(1);               }
 #define SHORT_DELAY()      { delayMicroseconds(20);              }
-#define LONG_DELAY()       { delay(25);                          }
-#define ENABLE_LOW()       { PORTB &= ~ (1<<1);                  }
-#define ENABLE_HIGH()      { PORTB |=   (1<<1);                  }
+#define POWER_ON_WAIT      50 /* milliseconds */
+#define ENABLE_LOW()       pinLow(LCD_ENABLE)
+#define ENABLE_HIGH()      pinHigh(LCD_ENABLE)
 
 /*
  * In order to keep this code pretty portable and hence usable in
@@ -93,12 +114,14 @@ static void lcdEnableSlow(void);
  * occurs in the macros so that any changes to the pin layout
  * and ports used can be easily modified by changing only a few of
  * these macros - there should be no hardware dependencies in any
- * non-macro code.
+ * non-macro code. The ports and pins themselves are given in pins.h.
  */
 #define SETUP_LCD_PINS(){     \
-	DDRD  = 0xff;             \
-	DDRB |= (1<<1) | (1<<0);  \
-	DDRC |= (1<<0) | (1<<1);  \
+	LCD_DATA_DDR = 0xff;      \
+	pinOutput(LCD_ENABLE);    \
+	pinOutput(LCD_RS);        \
+	pinOutput(LCD_CS1);       \
+	pinOutput(LCD_CS2);       \
 }
 
 /*
@@ -118,7 +141,7 @@ static void lcdEnableSlow(void);
  * enough time for the LCD's ICs to copy content from the
  * data-bus to the actual screen (i.e. their own RAM).
  */
-#define lcdWrite(x)        { PORTD = x; SHORT_DELAY();           }
+#define lcdWrite(x)        { LCD_DATA_PORT = x; SHORT_DELAY();   }
 
 /*
  * In order to pass data on the data bus to the LCD we
@@ -126,39 +149,28 @@ static void lcdEnableSlow(void);
  * we must strobe the enable line (which in our board is
  * the pin B1). This function provides that strobe at
  * a fast rate.
+ *
+ * (When built with LATENCY_STATS the length of each strobe is
+ * recorded, see latency.c.)
  */
 static void lcdEnable(void)
 {
+	latencyPulseBegin();
 	ENABLE_HIGH();
 	VERY_SHORT_DELAY();
 	ENABLE_LOW();
+	latencyPulseEnd();
 	VERY_SHORT_DELAY();
 }
 
-/*
- * Although we cannot find anything in the specification to
- * suggest we should slow down data transfer at the beginning,
- * it is preferred from experience (although not experimentation)
- * that when the devices are first turned on and initialised
- * they should be given some more time to do so. As such,
- * this function is tailored for when we are first communicating
- * with the LCD - which will be to turn it on and ensure it is
- * Initialised. */
-static void lcdEnableSlow(void)
-{
-	ENABLE_HIGH();
-	LONG_DELAY();
-	ENABLE_LOW();
-	LONG_DELAY();
-}
-
 /*
  * The following function should be called prior to using
- * any other lcd function - or at least the lcdRepaint function.
- * The reason being is that this function ensures that the
- * LCD is at the very least turned on and that all IO pins
- * are set to the proper direction and are set to HIGH/LOW
- * as appropriate for then using the LCD.
+ * any other lcd function, followed (as soon as any other set
+ * up has been done) by lcdTurnOn - or at least before the
+ * lcdRepaint function. The reason being is that these functions
+ * ensure that the LCD is at the very least turned on and that
+ * all IO pins are set to the proper direction and are set to
+ * HIGH/LOW as appropriate for then using the LCD.
  *
  * The commands needed to initialise and use the LCD screen
  * can be found in the specification we used to make this
@@ -217,6 +229,37 @@ void initLcdScreen(void)
 	/* Disable both ICs */
 	ICOFF();
 
+	/* The LCD is given some time to power up before we talk to
+	 * it (see lcdTurnOn), rather than sitting here waiting we
+	 * note the time and return so the rest of the set up can
+	 * carry on in the meantime.
+	 */
+	lcdPowerOnTime = millis();
+
+	/* We clear framebuffer (in Arduino ram) prior to use. */
+	lcdClear();
+}
+
+/*
+ * Although we cannot find anything in the specification to
+ * suggest we should slow down data transfer at the beginning,
+ * it is preferred from experience (although not experimentation)
+ * that when the devices are first turned on and initialised
+ * they should be given some more time to do so.
+ *
+ * Originally this was done by holding each strobe of the turn on
+ * commands for 25ms (100ms in total for both ICs), during which
+ * nothing else could be done. Now initLcdScreen notes when the
+ * LCD was powered up and we only wait out whatever is left of
+ * POWER_ON_WAIT here - both ICs were powered at the same time
+ * so one wait covers both of them.
+ */
+void lcdTurnOn(void)
+{
+	while(millis() - lcdPowerOnTime < POWER_ON_WAIT){
+		/* wait for the LCD to finish powering up */
+	}
+
 	/*
 	 * We're going to be using LCD register
 	 * commands here so we set the appropriate
@@ -228,37 +271,94 @@ void initLcdScreen(void)
 	/* Initialise 1st IC */
 	IC1();
 	lcdWrite( LCD_TURN_ONOFF_CMD(ON) );
-	lcdEnableSlow();
+	lcdEnable();
 
 	/* Initialise 2nd IC */
 	IC2();
 	lcdWrite( LCD_TURN_ONOFF_CMD(ON) );
-	lcdEnableSlow();
+	lcdEnable();
 
 	/* disable both ICs */
 	ICOFF();
 
 	/* done talking so we can disable the enable line */
 	ENABLE_HIGH();
-
-	/* We clear framebuffer (in Arduino ram) prior to use. */
-	lcdClear();
 }
 
-void lcdClear(void)
+#ifdef LCD_PING_PONG
+/*
+ * When built with LCD_PING_PONG, lcdRepaint swaps between the
+ * two ICs for every byte rather than sending all of one half
+ * of the screen and then all of the other.
+ *
+ * The delay in lcdWrite is there to give an IC time to store
+ * the byte it was last given before it is given another. The
+ * two ICs do this independently of each other, so while one
+ * is busy storing its byte we can be giving the other one its
+ * byte. Each IC then still gets the same time between its
+ * bytes, but only half the delay is needed between each
+ * lcdWrite, which almost halves the time a repaint takes.
+ *
+ * Each IC moves on to its next column by itself after every
+ * byte, so after setting both ICs to the start of a page we
+ * only have to keep giving them their bytes in order.
+ */
+#define HALF_DELAY()       { delayMicroseconds(10);              }
+#define lcdWriteHalf(x)    { LCD_DATA_PORT = x; HALF_DELAY();    }
+
+void lcdRepaint(void)
 {
-	uint16_t i;
+	uint8_t i, j;
+	volatile unsigned char* framePtr;
 
-	for(i=0; i<1024; i++){
-		framebuffer[i] = 0x00;
+	traceBegin(TRACE_REPAINT);
+
+	for(j=0; j<8; j++){
+		traceBegin(TRACE_PAGE + j);
+
+		/* Set up both ICs at the start of this page, the
+		 * register commands keep the full delay as these
+		 * go to the same IC one after the other. */
+		LCD_REGISTER_CMD();
+
+		IC1();
+		lcdWrite( LCD_GOTO_ROW(j) );
+		lcdEnable();
+		lcdWrite( LCD_GOTO_ORG()  );
+		lcdEnable();
+
+		IC2();
+		lcdWrite( LCD_GOTO_ROW(j) );
+		lcdEnable();
+		lcdWrite( LCD_GOTO_ORG()  );
+		lcdEnable();
+
+		LCD_PIXEL_CMD();
+
+		framePtr = &framebuffer[128*j];
+
+		for(i=0; i<64; i++){
+			IC1();
+			lcdWriteHalf(framePtr[i]);
+			lcdEnable();
+
+			IC2();
+			lcdWriteHalf(framePtr[i + 64]);
+			lcdEnable();
+		}
+		traceEnd(TRACE_PAGE + j);
 	}
-}
 
+	traceEnd(TRACE_REPAINT);
+}
+#else
 void lcdRepaint(void)
 {
 	uint8_t i, j;
 	volatile unsigned char* framePtr;
 
+	traceBegin(TRACE_REPAINT);
+
 	/* Talking to the first half of the screen
 	 * and so we only need to talk to the first
 	 * IC on the LCD.
@@ -285,6 +385,7 @@ void lcdRepaint(void)
 		 * and set a 1 - or rather 'or' the value that was previously
 		 * there with a new (1 << k) where k sets the pixel in
 		 * the correct place between the 0 and 7th pixel of that row. */
+		traceBegin(TRACE_PAGE + j);
 		lcdWrite( LCD_GOTO_ROW(j) );
 		lcdEnable();
 
@@ -308,6 +409,7 @@ void lcdRepaint(void)
 			lcdWrite(*framePtr++);
 			lcdEnable();
 		}
+		traceEnd(TRACE_PAGE + j);
 	}
 
 
@@ -318,6 +420,7 @@ void lcdRepaint(void)
 	IC2();
 
 	for(j=0; j<8; j++){
+		traceBegin(TRACE_PAGE + 8 + j);
 		LCD_REGISTER_CMD();
 
 		lcdWrite( LCD_GOTO_ROW(j) );
@@ -334,6 +437,71 @@ void lcdRepaint(void)
 			lcdWrite(*framePtr++);
 			lcdEnable();
 		}
+		traceEnd(TRACE_PAGE + 8 + j);
+	}
+
+	traceEnd(TRACE_REPAINT);
+}
+#endif
+
+/*
+ * lcdShowSplash sends the splash screen to the LCD. This is
+ * much the same procedure as lcdRepaint, but the image is
+ * decompressed (see rle.c) straight out of program memory a
+ * byte at a time rather than sent from framebuffer, so it never
+ * has to be held in SRAM and framebuffer is left free for the
+ * game (the splash stays on the screen until the first
+ * lcdRepaint, so main only shows it when built with
+ * SPLASH_HOLD, holding off the game for SPLASH_TIME).
+ *
+ * Since the image is stored a whole page (both halves of the
+ * screen) at a time, we swap between the ICs for each half of
+ * every page rather than doing all of one IC and then the other.
+ */
+void lcdShowSplash(void)
+{
+	uint8_t   i, j, k;
+	RleStream splash;
+
+	rleBegin(&splash, (const unsigned char*)SPLASH);
+
+	for(j=0; j<8; j++){
+		for(k=0; k<2; k++){
+			if(k == 0){
+				IC1();
+			}else{
+				IC2();
+			}
+
+			LCD_REGISTER_CMD();
+
+			lcdWrite( LCD_GOTO_ROW(j) );
+			lcdEnable();
+
+			lcdWrite( LCD_GOTO_ORG() );
+			lcdEnable();
+
+			LCD_PIXEL_CMD();
+
+			for(i=0; i<64; i++){
+				lcdWrite(rleNext(&splash));
+				lcdEnable();
+			}
+		}
+	}
+}
+
+#endif
+
+void lcdClear(void)
+{
+	uint16_t i;
+
+	/* (only the OLED's lcdRepaint may still be sending) */
+	lcdWait();
+
+	for(i=0; i<1024; i++){
+		framebuffer[i] = 0x00;
 	}
 }
 
@@ -410,15 +578,66 @@ void lcdDrawPixel(uint8_t x, uint8_t y)
 	framebuffer[ ((y>>3)<<7) + x ] |= 1 << (y & 0x07);
 }
 
+/*
+ * lcdDrawSprite draws an 8x8 sprite with its top-left corner
+ * at (x, y), giving the same result as plotting each of its
+ * pixels with lcdDrawPixel but a whole column at a time.
+ *
+ * The sprites are generated by tools/pbm2c in its 'shifted'
+ * layout: each of the 8 columns is stored already flipped
+ * (see lcdDrawPixel) and pre-shifted by each of the 8 possible
+ * offsets from the start of a page, as 2 bytes - the part
+ * falling into one page and the part falling into the page
+ * below. This way we only ever 'or' whole bytes into the frame
+ * buffer and never have to shift anything at runtime (the AVR
+ * can only shift by one bit per instruction).
+ */
+void lcdDrawSprite(const unsigned char* sprite, uint8_t x, uint8_t y)
+{
+	int8_t  top, page;
+	uint8_t i, column;
+	const unsigned char* spritePtr;
+
+	if(y > 63){
+		return;
+	}
+
+	/* After flipping, the bottom row of the sprite is the
+	 * top-most row in the frame buffer. This may be above
+	 * the frame buffer (at most 7 rows, i.e. page -1) when
+	 * the sprite hangs off the bottom of the screen. */
+	top  = 56 - y;
+	page = top >> 3;
+
+	spritePtr = sprite + ((top & 0x07) << 4);
+
+	for(i=0; i<8; i++, spritePtr+=2){
+		/* As with lcdDrawPixel, any columns off the side of
+		 * the screen are discarded */
+		column = x + i;
+		if(column > 127){
+			continue;
+		}
+
+		if(page >= 0){
+			framebuffer[(page<<7) + column]     |= pgm_read_byte(spritePtr);
+		}
+		if(page < 7){
+			framebuffer[((page+1)<<7) + column] |= pgm_read_byte(spritePtr + 1);
+		}
+	}
+}
+
 /*
  * Since in this LCD there are no preinserted alpha-numeric
  * bitmaps from which to draw out text characters we have
- * had to implement a simple function for doing this. It would
- * have been prefer to vertically-align the bitmaps for
- * optmising the blitz into the LCD but it is more clear this
- * way - especially considering we compiled the bitmaps on upside
- * down and need to write 'backwards' into the frame buffer to
- * correct this mistake.
+ * had to implement a simple function for doing this. The
+ * bitmaps are vertically-aligned so each byte can be blitzed
+ * straight into the frame buffer. Since the frame buffer is
+ * upside down (see lcdDrawPixel) each character's columns
+ * must go into it right to left, this is baked into the
+ * table by tools/pbm2c (originally the bitmaps were typed in
+ * the other way round and had to be written 'backwards').
  *
  * Note that the lcdPrintText function uses line offsets as
  * opposed to pixels, the lines are just the pages as discussed
@@ -431,6 +650,7 @@ void lcdDrawPixel(uint8_t x, uint8_t y)
 void lcdPrintText(char* text, uint8_t line)
 {
 	volatile unsigned char* framePtr;
+	const volatile unsigned char* textPtr;
 	uint8_t  i;
 	uint16_t j; /* text probably will never exceed 255 characters in length but just in case... */
 
@@ -447,22 +667,101 @@ void lcdPrintText(char* text, uint8_t line)
 	}
 
 	for(j=0; j<length; j++){
-		framePtr = &framebuffer[1023 - (line<<7) - (j*TEXT_WIDTH)];
+		/* Each character is blitzed from its right-most column in
+		 * the frame buffer (i.e. the left of the character on the
+		 * upside down screen) forwards, see above.
+		 */
+		framePtr = &framebuffer[1023 - (line<<7) - (j*TEXT_WIDTH) - (TEXT_WIDTH-1)];
+
+		if('A' <= text[j] && text[j] <= 'Z'){
+			textPtr = GET_TEXT_BYTE_UPPER(text[j]);
+		}else if('a' <= text[j] && text[j] <= 'z'){
+			textPtr = GET_TEXT_BYTE_LOWER(text[j]);
+		}else if(text[j] == '.'){
+			textPtr = GET_TEXT_DOT_ADDRESS;
+		}else{
+			textPtr = 0; /* blank space otherwise */
+		}
 
 		for(i=0; i<8; i++){
-			if('A' <= text[j] && text[j] <= 'Z'){
-				/* As mentioned above, in order to account for the error
-				 * of compiling the bitmaps the wrong way we have to
-				 * write to the framebuffer backwards
-				 */
-				*framePtr-- = pgm_read_byte(GET_TEXT_BYTE_UPPER(text[j]) + i);
-			}else if('a' <= text[j] && text[j] <= 'z'){
-				*framePtr-- = pgm_read_byte(GET_TEXT_BYTE_LOWER(text[j]) + i);
-			}else if(text[j] == '.'){
-				*framePtr-- = pgm_read_byte(GET_TEXT_DOT_ADDRESS         + i);
-			}else{
-				*framePtr-- = 0x00; /* blank space otherwise */
-			}
+			*framePtr++ = textPtr ? pgm_read_byte(textPtr + i) : 0x00;
+		}
+	}
+}
+
+/*
+ * lcdPrintSmallText works in the same way as lcdPrintText, but
+ * uses the much smaller (5x7 pixel) SMALL_TEXT font, which also
+ * has digits and punctuation (any character it doesn't have is
+ * printed as a '?'). The characters are proportional, i.e. each
+ * is only as wide as it needs to be ('i' takes up 3 columns where
+ * 'm' takes 5), so that around 30 characters fit onto a line.
+ *
+ * The text begins x pixels in from the left of the screen, the
+ * x coordinate following the text is returned so that more text
+ * can be printed after it. Anything past the edge of the screen
+ * is cut off.
+ */
+uint8_t lcdPrintSmallText(char* text, uint8_t line, uint8_t x)
+{
+	volatile unsigned char* framePtr;
+	const unsigned char*    textPtr;
+	uint16_t                entry;
+	uint8_t                 width;
+	char                    c;
+
+	if(line > 7){
+		return x;
+	}
+
+	/* As the frame buffer is upside down (see lcdDrawPixel and
+	 * lcdPrintText) we go through it backwards, starting at the
+	 * end of the page for this line.
+	 */
+	framePtr = &framebuffer[1023 - (line<<7) - x];
+
+	while((c = *text++) != '\0'){
+		if(c < SMALL_TEXT_FIRST || c > SMALL_TEXT_LAST){
+			c = '?';
+		}
+
+		/* Each entry in the index holds both where the character's
+		 * columns begin (in the top 13 bits) and how many
+		 * columns it has (in the bottom 3 bits). */
+		entry   = pgm_read_word(&SMALL_TEXT_INDEX[c - SMALL_TEXT_FIRST]);
+		textPtr = (const unsigned char*)SMALL_TEXT + (entry >> 3);
+		width   = (entry & 0x07) + SMALL_TEXT_SPACING;
+
+		while(width > 0 && x < 128){
+			*framePtr-- = (width > SMALL_TEXT_SPACING) ? pgm_read_byte(textPtr++) : 0x00;
+			width--;
+			x++;
+		}
+
+		if(x >= 128){
+			break;
 		}
 	}
+
+	return x;
+}
+
+/*
+ * lcdSmallTextWidth gives the number of pixels text takes up when
+ * printed by lcdPrintSmallText (e.g. for centring it), including
+ * the spacing after the last character.
+ */
+uint8_t lcdSmallTextWidth(char* text)
+{
+	uint16_t width = 0;
+	char     c;
+
+	while((c = *text++) != '\0'){
+		if(c < SMALL_TEXT_FIRST || c > SMALL_TEXT_LAST){
+			c = '?';
+		}
+		width += (pgm_read_word(&SMALL_TEXT_INDEX[c - SMALL_TEXT_FIRST]) & 0x07) + SMALL_TEXT_SPACING;
+	}
+
+	return width > 255 ? 255 : width;
 }
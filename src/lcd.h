@@ -14,10 +14,27 @@
 #define GET_TEXT_BYTE_LOWER(x)  (LOWER_CASE_ADDRESS + (x-'a')*BYTES_PER_CHARACTER)
 #define GET_TEXT_DOT_ADDRESS    (TEXT + 52*8)
 
+#define SMALL_TEXT_FIRST        ' '
+#define SMALL_TEXT_LAST         '~'
+#define SMALL_TEXT_SPACING      1 /* blank columns between characters */
+
 void initLcdScreen(void);
+void lcdTurnOn(void);
 void lcdRepaint(void);
+void lcdShowSplash(void);
 void lcdClear(void);
 void lcdDrawPixel(uint8_t x, uint8_t y);
+void lcdDrawSprite(const unsigned char* sprite, uint8_t x, uint8_t y); /* sprite must be in program memory, see tools/pbm2c */
 void lcdPrintText(char* text, uint8_t line); /* note this function is line based and not pixel based */
+uint8_t lcdPrintSmallText(char* text, uint8_t line, uint8_t x); /* as above, but starting x pixels in */
+uint8_t lcdSmallTextWidth(char* text);
+
+#ifdef LCD_SSD1306
+void lcdWait(void);   /* waits for lcdRepaint to finish, see oled.c */
+void lcdReport(void); /* prints how long the last lcdRepaint took */
+#else
+#define lcdWait()
+#define lcdReport()
+#endif
 
 #endif
@@ -20,14 +20,24 @@
 #include <avr/pgmspace.h>
 #include "lcd.h"
 #include "input.h"
+#include "uart.h"
+#include "profile.h"
+#include "trace.h"
+#include "latency.h"
+#include "stack.h"
+#include "boot.h"
+#include "script.h"
+#include "rle.h"
+#include "attract.h"
 #include "gamedefs.h"
 
 /* GAME DATA */
 static uint8_t                   lives;
 static uint8_t                   shipAlive;
 static uint8_t                   shipX,  shipY;
-static float                     enemyX, enemyY;
-static float                     enemyDX;
+static Formation                 formation;
+static ScriptEntity              marchScript;
+static ScriptEntity              fireScript;
 static uint8_t                   enemyAlive[ENEMY_COUNT];
 static uint8_t                   enemyRemaining;
 static uint8_t                   currBulletId;
@@ -35,38 +45,45 @@ static uint8_t                   bulletWait;
 static uint8_t                   bulletX[MAX_PLAYER_BULLETS];
 static uint8_t                   bulletY[MAX_PLAYER_BULLETS];
 static uint8_t                   currEnemyBulletId;
-static uint8_t                   enemyBulletWait;
 static uint8_t                   enemyBulletX[MAX_ENEMY_BULLETS];
 static uint8_t                   enemyBulletY[MAX_ENEMY_BULLETS];
+static uint8_t                   attractActive;
+static uint8_t                   attractButtons;
 
-/* alien8 and ship8 are 8x8 bitmaps used to represent
+/* ALIEN8 and SHIP8 are 8x8 sprites used to represent
  * the aliens and the player's ship respectively. They
- * are encoded horizontal-first, i.e. each byte of the
- * 8 bytes given is a horizontal row where 1 is pixel
- * and 0 is no-pixel (i.e. space).
+ * are generated (in assets.c) from the art in assets/
+ * and stored ready to be drawn by lcdDrawSprite.
  */
-static char alien8[] = { 0x00, 0x18, 0x3C, 0x7E, 0x5A, 0xFF, 0x54, 0xAA };
-static char ship8 [] = { 0x00, 0x18, 0x3C, 0x18, 0x99, 0xBD, 0xff, 0xE7 };
+extern volatile const unsigned char __attribute__((__progmem__)) ALIEN8[];
+extern volatile const unsigned char __attribute__((__progmem__)) SHIP8[];
+
+/* The scripts (in data.c) which the aliens follow */
+extern volatile const unsigned char __attribute__((__progmem__)) MARCH_SCRIPT[];
+extern volatile const unsigned char __attribute__((__progmem__)) FIRE_SCRIPT[];
 
 /* miscellaneous helpers */
 static char     stringHolder[17];
 
-/* 17-byte strings (16 characters plus 1 byte null terminator in C) */
-/* (keeping strings out of the stack since they really eat it up )  */
-volatile const char __attribute((__progmem__)) GAME_OVER_STRING[] = { "Game Over       " };
+/* Strings of up to 17 bytes (16 characters plus 1 byte null terminator in C) */
+/* (keeping strings out of the stack since they really eat it up )           */
+volatile const char __attribute((__progmem__)) GAME_OVER_STRING[] = { "Game Over"        };
 volatile const char __attribute((__progmem__)) PRESS_ANY_STRING[] = { "Press any key to" };
-volatile const char __attribute((__progmem__)) PLAY_AGAN_STRING[] = { "play again      " };
+volatile const char __attribute((__progmem__)) PLAY_AGAN_STRING[] = { "play again"       };
+volatile const char __attribute((__progmem__)) STACK_FREE_STRING[] = { "stack free "     };
 
 /* static prototypes */
 static void gameReset(void);
 static void gameOver (void);
 static void gameLoop (void);
-static void draw8by8 (char* bitmap, uint8_t x, uint8_t y);
+static void attractBot(void);
+static int  buttonDown(int buttonId);
 
 /* macros */
-#define drawAlien(x, y)  { draw8by8(alien8, x, y); }
-#define drawShip(x, y)   { draw8by8(ship8,  x, y); }
+#define drawAlien(x, y)  { lcdDrawSprite((const unsigned char*)ALIEN8, x, y); }
+#define drawShip(x, y)   { lcdDrawSprite((const unsigned char*)SHIP8,  x, y); }
 #define drawBullet(x, y) { lcdDrawPixel(x, y); lcdDrawPixel(x, y+1); }
+#define printCentred(text, line) { lcdPrintSmallText(text, line, (SCREEN_WIDTH - lcdSmallTextWidth(text))/2); }
 
 static void gameReset(void)
 {
@@ -76,14 +93,17 @@ static void gameReset(void)
 	shipAlive         = ALIVE;
 	shipX             = 60;
 	shipY             = 50;
-	enemyX            = 10.0f;
-	enemyY            = 0.0f;
-	enemyDX           = 0.5f;
+	formation.x       = 10.0f;
+	formation.y       = 0.0f;
+	formation.hitEdge = 0;
+	formation.fire    = 0;
 	enemyRemaining    = ENEMY_COUNT;
 	currBulletId      = 0;
 	bulletWait        = 0;
 	currEnemyBulletId = 0;
-	enemyBulletWait   = ENEMY_WAIT_BETWEEN_FIRE;
+
+	scriptStart(&marchScript, (const unsigned char*)MARCH_SCRIPT);
+	scriptStart(&fireScript,  (const unsigned char*)FIRE_SCRIPT );
 
 	for(i=0; i<ENEMY_COUNT; i++){
 		enemyAlive[i] = ALIVE;
@@ -100,43 +120,138 @@ static void gameReset(void)
 
 static void gameOver(void)
 {
+	unsigned long idleStart;
+
 	gameReset();
 
+	/* The messages are printed in the small font, each centred
+	 * on its own line on an otherwise blank screen */
+	lcdClear();
 	memcpy_P(stringHolder, GAME_OVER_STRING, sizeof(GAME_OVER_STRING) );
-	lcdPrintText(stringHolder, 0);
+	printCentred(stringHolder, 2);
 	memcpy_P(stringHolder, PRESS_ANY_STRING, sizeof(PRESS_ANY_STRING) );
-	lcdPrintText(stringHolder, 1);
+	printCentred(stringHolder, 4);
 	memcpy_P(stringHolder, PLAY_AGAN_STRING, sizeof(PLAY_AGAN_STRING) );
-	lcdPrintText(stringHolder, 2);
+	printCentred(stringHolder, 5);
+
+	/* Along the bottom we show how many bytes of SRAM the stack
+	 * has never reached (see stack.c), the number is written in
+	 * after the text (which leaves room for 5 digits) */
+	memcpy_P(stringHolder, STACK_FREE_STRING, sizeof(STACK_FREE_STRING) );
+	utoa(stackUnused(), stringHolder + sizeof(STACK_FREE_STRING) - 1, 10);
+	lcdPrintSmallText(stringHolder, 7, 0);
 
 	lcdRepaint();
+
+	/* Between games is a good point to print any profiling
+	 * results since the serial output won't affect play. */
+	profileDump();
+	traceDump();
+	latencyDump();
+	lcdReport();
+	stackReport();
+	if(attractActive){
+		attractReport();
+	}
+
 	while( isAnyKeyDown()); /* wait firstly for user to release any keys */
-	while(!isAnyKeyDown()); /* wait for another press */
+
+	/* Then wait for another press, but if nobody comes along
+	 * for a while the game starts playing itself (see
+	 * attractBot) until somebody does.
+	 */
+	idleStart = millis();
+	while(!isAnyKeyDown()){
+		if(millis() - idleStart >= ATTRACT_IDLE_WAIT){
+			attractActive = 1;
+			attractReset();
+			return;
+		}
+	}
+	attractActive = 0;
 }
 
-static void draw8by8(char* bitmap, uint8_t x, uint8_t y)
+/*
+ * While in attract mode the game plays itself, this is done by
+ * pressing 'virtual' buttons (attractButtons, one bit for each
+ * of the BUTTON_USER_ values) which buttonDown then reports in
+ * place of the real ones. The bot is very simple: it moves out
+ * of the way of the nearest enemy bullet coming down on the
+ * ship, otherwise it moves under the nearest alien and fires.
+ */
+static void attractBot(void)
 {
-	/* Given that the lcd display uses an 8 bit vertically
-	 * aligned pixel bus, it would have been more optimal
-	 * if we had arranged the bitmaps for the ships and
-	 * aliens vertically-aligned instead of horizontally
-	 * as was done and then blitted only to the two 8-bit
-	 * segments that we needed to on the LCD.
-	 *
-	 * However, this method is pretty general and could be
-	 * ported to a much wider number of devices - not to
-	 * mention it is easier to read, understand and maintain.
-	 */
+	uint8_t i, shipMiddle, nearest;
+	int     x, target, distance;
 
-	uint8_t i, j;
+	attractButtons = 0;
+	shipMiddle     = shipX + SHIP_WIDTH/2;
 
-	for(j=0; j<8; j++){
-		for(i=0; i<8; i++){
-			if((bitmap[j] & (1<<i)) != 0x00){
-				lcdDrawPixel(x+i, y+j);
-			}
+	/* Look for the closest bullet (i.e. the lowest one above
+	 * the ship) which would hit the ship, or only just miss
+	 * it, ignoring any still too far away to worry about. */
+	nearest = 0xff;
+	for(i=0; i<MAX_ENEMY_BULLETS; i++){
+		if(enemyBulletX[i] == 0 || enemyBulletY[i] == 0){
+			continue;
+		}
+		if(enemyBulletY[i] > shipY + SHIP_HEIGHT || enemyBulletY[i] + 3*SHIP_HEIGHT < shipY){
+			continue;
+		}
+		if(enemyBulletX[i] + 2 < shipX || enemyBulletX[i] > shipX + SHIP_WIDTH + 2){
+			continue;
+		}
+		if(nearest == 0xff || enemyBulletY[i] > enemyBulletY[nearest]){
+			nearest = i;
 		}
 	}
+
+	if(nearest != 0xff){
+		/* Dodge away from the side of the ship the bullet
+		 * is on, unless that would run into the edge */
+		if((enemyBulletX[nearest] < shipMiddle && shipX < SCREEN_WIDTH-SHIP_WIDTH) || shipX == 0){
+			attractButtons |= 1 << BUTTON_USER_RIGHT;
+		}else{
+			attractButtons |= 1 << BUTTON_USER_LEFT;
+		}
+		return;
+	}
+
+	/* Otherwise find the alien nearest to the ship, along
+	 * the x-axis (the same positions as used in gameLoop) */
+	target   = shipMiddle;
+	distance = SCREEN_WIDTH;
+	for(i=0; i<ENEMY_COUNT; i++){
+		if(enemyAlive[i] != ALIVE){
+			continue;
+		}
+		if(i < ROW1_ENEMY_COUNT){
+			x = (int)(formation.x + ALIEN_BETWEEN_OFFSET*i);
+		}else{
+			x = (int)(formation.x + 9 + ALIEN_BETWEEN_OFFSET*(i - ROW1_ENEMY_COUNT));
+		}
+		x += ALIEN_WIDTH/2;
+		if(abs(x - shipMiddle) < distance){
+			distance = abs(x - shipMiddle);
+			target   = x;
+		}
+	}
+
+	if(target < shipMiddle - 1){
+		attractButtons |= 1 << BUTTON_USER_LEFT;
+	}else if(target > shipMiddle + 1){
+		attractButtons |= 1 << BUTTON_USER_RIGHT;
+	}else{
+		attractButtons |= 1 << BUTTON_USER_FIRE;
+	}
+}
+
+static int buttonDown(int buttonId)
+{
+	if(attractActive){
+		return attractButtons & (1 << buttonId);
+	}
+	return isButtonDown(buttonId);
 }
 
 static void gameLoop(void)
@@ -148,12 +263,26 @@ static void gameLoop(void)
 	/* Check user input.   If any performed logic
 	 * needs   to   be   then   we   do   so here.
 	 */
-	if(isButtonDown(BUTTON_USER_LEFT)){
+	traceBegin(TRACE_INPUT);
+
+	/* If somebody presses a button while the game is playing
+	 * itself, we hand them a fresh game */
+	if(attractActive){
+		if(isAnyKeyDown()){
+			attractReport();
+			attractActive = 0;
+			gameReset();
+		}else{
+			attractBot();
+		}
+	}
+
+	if(buttonDown(BUTTON_USER_LEFT)){
 		if(shipX > 0)
 			shipX -= SHIP_X_MOVE;
 	}
 
-	if(isButtonDown(BUTTON_USER_RIGHT)){
+	if(buttonDown(BUTTON_USER_RIGHT)){
 		if(shipX < (SCREEN_WIDTH-SHIP_WIDTH))
 			shipX += SHIP_X_MOVE;
 	}
@@ -169,7 +298,7 @@ static void gameLoop(void)
 	 * and the user  is pressing the  fire  button
 	 * then we fire a bullet.
 	 */
-	if(isButtonDown(BUTTON_USER_FIRE) && bulletWait == 0){
+	if(buttonDown(BUTTON_USER_FIRE) && bulletWait == 0){
 		/* The bullet should be offset so it gives
 		 * the appearance that is is  coming from
 		 * the front-middle of our ship.
@@ -199,6 +328,8 @@ static void gameLoop(void)
 		bulletWait    = PLAYER_WAIT_BETWEEN_FIRE;
 	}
 
+	traceEnd(TRACE_INPUT);
+
 	/* At this point we draw the ship, but we do
 	 * so only if 1. the ship is alive and 2. if
 	 * shipAlive is an odd number. The reason for
@@ -258,7 +389,7 @@ static void gameLoop(void)
 			 * next fire.
 			 */
 			bulletWait      = 0;
-			enemyBulletWait = ENEMY_WAIT_BETWEEN_FIRE;
+			scriptStart(&fireScript, (const unsigned char*)FIRE_SCRIPT);
 		}else{
 			/* Or the user has no  lives and must
 			 * go back to the beginning.
@@ -314,15 +445,20 @@ static void gameLoop(void)
 	 * Also  note  here  the  the  aliens  firing
 	 * sequence must also obey a similar delay to
 	 * which the  player must obey  (usually this
-	 * will disadvantage the aliens more).
+	 * will disadvantage the aliens more), which
+	 * along with how the aliens move is decided
+	 * by the scripts they follow (see script.c
+	 * and data.c) - these are run here, before
+	 * we come to draw the aliens.
 	 */
-	if(enemyBulletWait > 0){
-		enemyBulletWait -- ;
-		if(enemyBulletWait == 0 && enemyRemaining > 0){
-			shipToFire      = rand() % enemyRemaining;
-			enemyBulletWait = ENEMY_WAIT_BETWEEN_FIRE;
-		}
+	scriptRun(&marchScript, &formation);
+	scriptRun(&fireScript,  &formation);
+
+	if(formation.fire && enemyRemaining > 0){
+		shipToFire = rand() % enemyRemaining;
 	}
+	formation.fire    = 0;
+	formation.hitEdge = 0;
 
 	/* Here is where we start to draw the aliens.
 	 *
@@ -348,8 +484,8 @@ static void gameLoop(void)
 		 * ship-dying  but   now with the  aliens.
 		 */
 		if(enemyAlive[i] % 2 == 1){
-			x = (int)(enemyX + ALIEN_BETWEEN_OFFSET*i);
-			y = (int)(enemyY + 0);
+			x = (int)(formation.x + ALIEN_BETWEEN_OFFSET*i);
+			y = (int)(formation.y + 0);
 
 			drawAlien(x, y);
 
@@ -395,7 +531,6 @@ static void gameLoop(void)
 				 */
 				currEnemyBulletId++;
 				currEnemyBulletId %= MAX_ENEMY_BULLETS;
-				enemyBulletWait    = ENEMY_WAIT_BETWEEN_FIRE;
 			}
 
 			/* In keeping with the original Space
@@ -406,12 +541,15 @@ static void gameLoop(void)
 			 * increase speed.
 			 */
 			if( x <= 0 || (x + ALIEN_WIDTH) >= SCREEN_WIDTH ){
-				/* Here we  switch the   direction
-				 * the aliens are travelling along
-				 * the x-axis  and   increase  the
-				 * speed by the ALIEN_INCREASE_SPEED_BY
-				 * factor. Also,  we  increase the
-				 * y-coordinate of all aliens too.
+				/* Here we  only  note  that   an
+				 * edge  has  been  touched,  the
+				 * script the aliens follow  will
+				 * then   switch   the  direction
+				 * they  are  travelling  along
+				 * the x-axis, increase the  speed
+				 * and increase the y-coordinate
+				 * of all aliens at the start  of
+				 * the next frame.
 				 * (Keep in mind   that the higher
 				 * the y-coordinate, the lower down
 				 * the screen we are  going - this
@@ -420,8 +558,7 @@ static void gameLoop(void)
 				 * breadboard and could be changed
 				 * easily later.)
 				 */
-				enemyDX *= -ALIEN_INCREASE_SPEED_BY;
-				enemyY  +=  ALIEN_INCREASE_Y_BY;
+				formation.hitEdge = 1;
 			}
 
 			/* We want to check that the aliens haven't
@@ -519,8 +656,8 @@ static void gameLoop(void)
 		 */
 		k = ROW1_ENEMY_COUNT + i;
 		if(enemyAlive[k] % 2 == 1){
-			x = (int)(enemyX + 9 + ALIEN_BETWEEN_OFFSET*i);
-			y = (int)(enemyY + ALIEN_HEIGHT);
+			x = (int)(formation.x + 9 + ALIEN_BETWEEN_OFFSET*i);
+			y = (int)(formation.y + ALIEN_HEIGHT);
 
 			drawAlien(x, y);
 
@@ -530,12 +667,10 @@ static void gameLoop(void)
 
 				currEnemyBulletId++;
 				currEnemyBulletId %= MAX_ENEMY_BULLETS;
-				enemyBulletWait    = ENEMY_WAIT_BETWEEN_FIRE;
 			}
 
 			if( x <= 0 || SCREEN_WIDTH <= (x + ALIEN_WIDTH) ){
-				enemyDX *= -ALIEN_INCREASE_SPEED_BY;
-				enemyY  += ALIEN_INCREASE_Y_BY;
+				formation.hitEdge = 1;
 			}
 
 			if(y + ALIEN_HEIGHT >= SCREEN_HEIGHT){
@@ -560,11 +695,6 @@ static void gameLoop(void)
 		}
 	}
 
-	/* We alter the x-offset of every alien by
-	 * altering enemyX. We use this to move aliens
-	 * left or right depending on enemyDX. */
-	enemyX += enemyDX;
-
 	/* Here we loop through and draw all bullets.
 	 * Originally we considered using one array to
 	 * hold all (enemy and player) bullets which
@@ -659,16 +789,62 @@ static void gameLoop(void)
 
 int main(void)
 {
+	uint8_t       firstFrame = 1;
+#ifdef SPLASH_HOLD
+	unsigned long splashShown;
+#endif
+
 	/* Must call init for arduino to work properly */
 	init();
+	uartInit();
+	profileInit();
+	latencyInit();
+	bootMark(BOOT_INIT);
+
+	/* The LCD needs some time after powering up before it can
+	 * be turned on, so we start it off first and do the rest
+	 * of our set up while we wait for it.
+	 */
 	initLcdScreen();
+	bootMark(BOOT_LCD_POWER);
+
 	initButtons();
+	bootMark(BOOT_INPUT);
 
 	gameReset();
+	bootMark(BOOT_GAME);
+
+	lcdTurnOn();
+	bootMark(BOOT_LCD_ON);
+
+#ifdef SPLASH_HOLD
+	/* The splash is held up for SPLASH_TIME (or until a button
+	 * is pressed) so it is actually seen before the game's first
+	 * frame replaces it. This only delays the game, so the time
+	 * is not counted as part of start up.
+	 */
+	lcdShowSplash();
+	bootMark(BOOT_SPLASH);
+
+	splashShown = millis();
+	while(millis() - splashShown < SPLASH_TIME && !isAnyKeyDown()){
+		/* let the player have a look at the splash */
+	}
+	bootSkip((millis() - splashShown) * 1000UL);
+#endif
+
+	/* With RLE_BENCH defined, we time how fast the splash
+	 * decompresses (into framebuffer, which is cleared before
+	 * the first frame is drawn anyway). */
+	rleReport();
 
 	while(1){
 		/* Before we render a frame we clear the frame buffer */
+		attractFrameBegin();
+
+		traceBegin(TRACE_CLEAR);
 		lcdClear();
+		traceEnd(TRACE_CLEAR);
 
 		/* Now we render the scene - as this is a microcontroller
 		 * and not a full-blown GPCPU we've chosen to also do the
@@ -677,12 +853,27 @@ int main(void)
 		 *   * update, and
 		 *   * render.
 		 */
+		traceBegin(TRACE_UPDATE);
 		gameLoop();
+		traceEnd(TRACE_UPDATE);
 
 		/* We flush the frame buffer out to the lcd screen here */
 		lcdRepaint();
 
+		if(firstFrame){
+			/* Start up is over once the first frame is shown */
+			bootMark(BOOT_FIRST_FRAME);
+			bootReport();
+			firstFrame = 0;
+		}
+
+		if(attractActive){
+			attractFrameEnd();
+		}
+
 		/* We keep it at about 15 fps for nice retro effect :) */
+		traceBegin(TRACE_IDLE);
 		delay(50);
+		traceEnd(TRACE_IDLE);
 	}
 }
@@ -0,0 +1,293 @@
+/*
+  oled.c  - this file is an alternative to the hardware half
+  of lcd.c for a 128x64 SSD1306 OLED panel on the hardware
+  SPI, it is only used when building with LCD_SSD1306 defined
+  (in which case lcd.c leaves out its own versions of these
+  functions, the drawing functions are shared).
+
+  Note the following pins are used and their purposes
+  listed:
+
+  Pins B1 and B2 are the SPI's clock and data lines
+  Pin B0 is the panel's chip select
+  Pin C0 selects between commands (low) and pixel data (high)
+  Pin C1 is the panel's reset line
+
+  (these are set in pins.h and may be changed there, apart
+  from the SPI's own pins)
+
+  The panel's memory is laid out in pages of 8 rows by 128
+  columns just as our framebuffer is, so a repaint is just
+  the 1024 bytes of framebuffer sent in order. Rather than
+  waiting for each byte to go out, the SPI's transfer complete
+  interrupt hands it the next one, so lcdRepaint returns once
+  the transfer has been started.
+
+  Be aware that this does not leave the main loop much time
+  while the transfer is going on. At 8MHz a byte takes only 16
+  cycles to go out, which is less than the interrupt spends
+  just saving and restoring registers - counting the
+  instructions, each byte costs around 50 cycles, so a frame
+  takes in the region of 3.5ms (against over 20ms for the
+  parallel LCD, with its delay after every byte) and very
+  nearly all of that is spent in the interrupt. The time the
+  last transfer actually took is printed over serial by
+  lcdReport (at the game over screen).
+
+  Note that the protocol interface implemented here is
+  based on the SSD1306 datasheet (Solomon Systech, rev 1.1).
+  tools/oledtest.c checks what is sent against a model of the
+  panel on the PC, including which way up the picture shows.
+*/
+#ifdef LCD_SSD1306
+
+#include <WProgram.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include "lcd.h"
+#include "pins.h"
+#include "rle.h"
+#include "trace.h"
+#include "uart.h"
+
+extern volatile       unsigned char                              framebuffer[];
+extern volatile const unsigned char __attribute__((__progmem__)) SPLASH[];
+
+/* The time (in milliseconds) the panel was reset, see lcdTurnOn */
+static unsigned long oledPowerOnTime;
+
+/* The transfer in progress, oledPtr is the next byte to send and
+ * oledEnd is one past the last, oledBusy is set until the
+ * interrupt has sent the last byte. */
+static volatile unsigned char* volatile oledPtr;
+static volatile unsigned char* volatile oledEnd;
+static volatile uint8_t                 oledBusy;
+static unsigned long                    oledStart;
+static volatile unsigned long           oledTime; /* microseconds the last transfer took */
+
+/* Panel specific commands */
+#define OLED_SET_COLUMNS      0x21 /* followed by the first and last column */
+#define OLED_SET_PAGES        0x22 /* followed by the first and last page */
+#define OLED_DISPLAY_ON       0xaf
+#define POWER_ON_WAIT         100 /* milliseconds */
+
+/* Macros */
+#define OLED_COMMAND_MODE()   pinLow(OLED_DC)
+#define OLED_DATA_MODE()      pinHigh(OLED_DC)
+#define OLED_SELECT()         pinLow(OLED_CS)
+#define OLED_DESELECT()       pinHigh(OLED_CS)
+
+/*
+ * The commands sent to the panel when it is turned on. The
+ * KS0108 panel this game was written for is mounted upside
+ * down, so the framebuffer holds the picture turned around
+ * (see lcdDrawPixel). Rather than change the drawing code we
+ * have the panel turn it back, by scanning the columns (0xa0)
+ * and rows (0xc0) from the opposite ends to usual - if your
+ * panel is the other way up use 0xa1 and 0xc8 instead.
+ */
+static const unsigned char __attribute__((__progmem__)) OLED_INIT[] = {
+	0xae,       /* display off while we set up */
+	0xd5, 0x80, /* clock divider, the default */
+	0xa8, 0x3f, /* 64 rows */
+	0xd3, 0x00, /* no vertical offset */
+	0x40,       /* start at row 0 */
+	0x8d, 0x14, /* turn on the internal charge pump */
+	0x20, 0x00, /* horizontal addressing, i.e. a page at a time */
+	0xa0,       /* column scan direction, see above */
+	0xc0,       /* row scan direction, see above */
+	0xda, 0x12, /* row pin layout for 128x64 panels */
+	0x81, 0xcf, /* contrast */
+	0xd9, 0xf1, /* pre-charge period for the charge pump */
+	0xdb, 0x40, /* deselect level */
+	0xa4,       /* show the panel's memory */
+	0xa6        /* not inverted */
+};
+
+/*
+ * oledSend puts a byte out on the SPI and waits until it has
+ * gone, this is only used for commands and the splash screen,
+ * as lcdRepaint leaves the sending to the interrupt below.
+ */
+static void oledSend(uint8_t data)
+{
+	SPDR = data;
+	while(!(SPSR & (1 << SPIF))){
+		/* wait for the byte to be sent */
+	}
+}
+
+/*
+ * oledAddressAll sets the panel up to receive a whole frame,
+ * the panel steps through the columns and then the pages by
+ * itself so the data can then follow in one go.
+ */
+static void oledAddressAll(void)
+{
+	OLED_COMMAND_MODE();
+	oledSend(OLED_SET_COLUMNS);
+	oledSend(0);
+	oledSend(127);
+	oledSend(OLED_SET_PAGES);
+	oledSend(0);
+	oledSend(7);
+	OLED_DATA_MODE();
+}
+
+/*
+ * The SPI's transfer complete interrupt, each time a byte has
+ * gone out we hand the SPI the next one, once there are none
+ * left we switch the interrupt back off (so oledSend can poll
+ * the SPI again) and let go of the panel.
+ */
+ISR(SPI_STC_vect)
+{
+	if(oledPtr != oledEnd){
+		SPDR = *oledPtr++;
+	}else{
+		SPCR &= ~(1 << SPIE);
+		OLED_DESELECT();
+		oledTime = micros() - oledStart;
+		oledBusy = 0;
+	}
+}
+
+void initLcdScreen(void)
+{
+	/* The SPI's select pin must be an output before we make the
+	 * SPI a master, otherwise the SPI may drop back to being
+	 * a slave if the pin happens to be pulled low.
+	 */
+	OLED_DESELECT();
+	pinOutput(OLED_CS);
+	pinOutput(OLED_DC);
+	pinOutput(OLED_RESET);
+	pinOutput(SPI_SCK);
+	pinOutput(SPI_MOSI);
+
+	/* Master, mode 0, at half the cpu clock (i.e. 8MHz, the
+	 * panel is good for up to 10MHz) */
+	SPCR = (1 << SPE) | (1 << MSTR);
+	SPSR = (1 << SPI2X);
+
+	/* Reset the panel, this need only be held low for a few
+	 * microseconds */
+	pinLow(OLED_RESET);
+	delayMicroseconds(10);
+	pinHigh(OLED_RESET);
+
+	/* As with the parallel LCD, we note the time and carry on
+	 * rather than waiting for the panel here (see lcdTurnOn) */
+	oledPowerOnTime = millis();
+
+	lcdClear();
+}
+
+void lcdTurnOn(void)
+{
+	uint8_t i;
+
+	while(millis() - oledPowerOnTime < POWER_ON_WAIT){
+		/* wait for the panel's charge pump to settle */
+	}
+
+	OLED_SELECT();
+	OLED_COMMAND_MODE();
+
+	for(i=0; i<sizeof(OLED_INIT); i++){
+		oledSend(pgm_read_byte(&OLED_INIT[i]));
+	}
+
+	/* The panel's memory is not cleared when it is reset, so
+	 * we blank it before it is shown */
+	oledAddressAll();
+	for(i=0; i<128; i++){
+		oledSend(0); oledSend(0); oledSend(0); oledSend(0);
+		oledSend(0); oledSend(0); oledSend(0); oledSend(0);
+	}
+
+	OLED_COMMAND_MODE();
+	oledSend(OLED_DISPLAY_ON);
+
+	OLED_DESELECT();
+}
+
+/*
+ * lcdWait waits until the last lcdRepaint has finished sending
+ * framebuffer. Anything about to change framebuffer must call
+ * this first (lcdClear does) or part of the next frame may be
+ * sent along with the last one.
+ */
+void lcdWait(void)
+{
+	while(oledBusy){
+		/* wait for the interrupt to send the last byte */
+	}
+}
+
+void lcdRepaint(void)
+{
+	/* Only the setting up is traced here, the sending itself
+	 * happens in the interrupt (see the top of this file for
+	 * how little time that leaves the game). */
+	lcdWait();
+
+	traceBegin(TRACE_REPAINT);
+
+	OLED_SELECT();
+	oledAddressAll();
+
+	oledPtr  = &framebuffer[1];
+	oledEnd  = &framebuffer[1024];
+	oledBusy  = 1;
+	oledStart = micros();
+
+	/* Sending the first byte by hand starts off the chain
+	 * of interrupts which sends the rest. This must come
+	 * before the interrupt is turned on: the last oledSend
+	 * left the transfer complete flag set, and writing SPDR
+	 * (having read SPSR) is what clears it - turned on first,
+	 * the interrupt would fire straight away and collide with
+	 * our own write of the first byte. */
+	SPDR  = framebuffer[0];
+	SPCR |= (1 << SPIE);
+
+	traceEnd(TRACE_REPAINT);
+}
+
+void lcdReport(void)
+{
+	lcdWait();
+
+	uartPrint("oled: repaint took ");
+	uartPrintNumber(oledTime);
+	uartPrint("us\r\n");
+}
+
+/*
+ * lcdShowSplash sends the splash screen, decompressing it (see
+ * rle.c) straight out of program memory. Since the splash is
+ * stored in the same page by 128 layout as framebuffer this
+ * is the same as lcdRepaint, but only happens once so the
+ * bytes are simply sent one after the other.
+ */
+void lcdShowSplash(void)
+{
+	uint16_t  i;
+	RleStream splash;
+
+	rleBegin(&splash, (const unsigned char*)SPLASH);
+
+	lcdWait();
+
+	OLED_SELECT();
+	oledAddressAll();
+
+	for(i=0; i<1024; i++){
+		oledSend(rleNext(&splash));
+	}
+
+	OLED_DESELECT();
+}
+
+#endif
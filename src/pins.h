@@ -0,0 +1,123 @@
+/*
+  pins.h  - this file says which port and pin each of the
+  LCD and button signals is wired to, so that a different
+  board (or a different circuit on the same board) needs
+  changes only here and not in lcd.c or input.c.
+
+  Each signal NAME is given as NAME_PORT (the output
+  register), NAME_DDR (the direction register), NAME_PIN
+  (the input register) and NAME_BIT (the pin number). Any
+  of these may instead be given on the compiler's command
+  line, e.g.
+
+    -DLCD_ENABLE_PORT=PORTA -DLCD_ENABLE_DDR=DDRA -DLCD_ENABLE_BIT=4
+
+  in which case the whole group for that signal must be
+  given.
+
+  As the register and the pin are both known when compiling,
+  pinHigh(NAME) and pinLow(NAME) compile to a single sbi or
+  cbi instruction (for the lower ports A-G; ports H-L are
+  outside of the range of those instructions and take a
+  read-modify-write), exactly as the hand written
+  'PORTB |= (1<<1)' did before.
+*/
+#ifndef pinsh
+#define pinsh
+
+#include <avr/io.h>
+
+/* The LCD's 8-bit data bus, which must be a whole port */
+#ifndef LCD_DATA_PORT
+#define LCD_DATA_PORT       PORTD
+#define LCD_DATA_DDR        DDRD
+#endif
+
+/* The LCD's enable (strobe) line */
+#ifndef LCD_ENABLE_PORT
+#define LCD_ENABLE_PORT     PORTB
+#define LCD_ENABLE_DDR      DDRB
+#define LCD_ENABLE_BIT      1
+#endif
+
+/* The LCD's register/pixel select line (D/I on the datasheet) */
+#ifndef LCD_RS_PORT
+#define LCD_RS_PORT         PORTB
+#define LCD_RS_DDR          DDRB
+#define LCD_RS_BIT          0
+#endif
+
+/* The two IC select lines, CS1 chooses the first IC, CS2 the second */
+#ifndef LCD_CS1_PORT
+#define LCD_CS1_PORT        PORTC
+#define LCD_CS1_DDR         DDRC
+#define LCD_CS1_BIT         1
+#endif
+
+#ifndef LCD_CS2_PORT
+#define LCD_CS2_PORT        PORTC
+#define LCD_CS2_DDR         DDRC
+#define LCD_CS2_BIT         0
+#endif
+
+/* The SSD1306 OLED (see oled.c), used instead of the above when
+ * building with LCD_SSD1306. The clock and data lines are fixed
+ * by the hardware SPI (B1 and B2 on the Mega), B0 is the SPI's
+ * own select pin, which must be an output for the SPI to stay
+ * in master mode, so we use it as the panel's chip select. */
+#ifndef OLED_CS_PORT
+#define OLED_CS_PORT        PORTB
+#define OLED_CS_DDR         DDRB
+#define OLED_CS_BIT         0
+#endif
+
+#ifndef OLED_DC_PORT
+#define OLED_DC_PORT        PORTC
+#define OLED_DC_DDR         DDRC
+#define OLED_DC_BIT         0
+#endif
+
+#ifndef OLED_RESET_PORT
+#define OLED_RESET_PORT     PORTC
+#define OLED_RESET_DDR      DDRC
+#define OLED_RESET_BIT      1
+#endif
+
+#define SPI_SCK_PORT        PORTB
+#define SPI_SCK_DDR         DDRB
+#define SPI_SCK_BIT         1
+
+#define SPI_MOSI_PORT       PORTB
+#define SPI_MOSI_DDR        DDRB
+#define SPI_MOSI_BIT        2
+
+/* The three buttons, these are active low (pulled up) */
+#ifndef BUTTON0_PORT
+#define BUTTON0_PORT        PORTC
+#define BUTTON0_DDR         DDRC
+#define BUTTON0_PIN         PINC
+#define BUTTON0_BIT         3
+#endif
+
+#ifndef BUTTON1_PORT
+#define BUTTON1_PORT        PORTC
+#define BUTTON1_DDR         DDRC
+#define BUTTON1_PIN         PINC
+#define BUTTON1_BIT         4
+#endif
+
+#ifndef BUTTON2_PORT
+#define BUTTON2_PORT        PORTC
+#define BUTTON2_DDR         DDRC
+#define BUTTON2_PIN         PINC
+#define BUTTON2_BIT         5
+#endif
+
+/* Operations on a signal given by its name above */
+#define pinHigh(name)       { name##_PORT |=  (1 << name##_BIT); }
+#define pinLow(name)        { name##_PORT &= ~(1 << name##_BIT); }
+#define pinOutput(name)     { name##_DDR  |=  (1 << name##_BIT); }
+#define pinInput(name)      { name##_DDR  &= ~(1 << name##_BIT); }
+#define pinRead(name)       (name##_PIN & (1 << name##_BIT))
+
+#endif
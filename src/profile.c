@@ -0,0 +1,206 @@
+/*
+  profile.c - this file is responsible for a simple function
+  level profiler, used to find out where each frame's time
+  actually goes (e.g. lcdDrawSprite versus lcdDrawPixel versus
+  lcdRepaint).
+
+  To use it, define PROFILE_FUNCTIONS for every file and
+  compile main.c, lcd.c, input.c and script.c (and only those)
+  with -finstrument-functions. GCC will then call the two
+  hooks at the bottom of this file on entry to and exit from
+  every function in those files. Files with interrupt handlers
+  (such as oled.c or uart.c) must not be instrumented, as the
+  hooks are not safe to call from an interrupt.
+
+  Timing is taken from timer 5, which we take over and run
+  with no prescaler so it counts CPU cycles - both on the
+  device and under an AVR simulator. The 16-bit count is
+  extended to 32 bits by counting overflows.
+
+  The results are printed over the serial port by profileDump
+  in the "collapsed stack" format used by flamegraph.pl, e.g.
+
+    0x02f4;0x0a1c;0x0b40 1843210
+
+  where each address is a function (byte address, ready to
+  be passed to avr-addr2line -f) and the number is the self
+  time in cycles spent with exactly that call stack. The
+  script tools/flamesyms.sh swaps the addresses for function
+  names using the firmware's elf.
+*/
+#ifdef PROFILE_FUNCTIONS
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "uart.h"
+#include "profile.h"
+
+#define NO_INSTRUMENT __attribute__((__no_instrument_function__))
+
+/* Each node in the call tree is one distinct call stack, the
+ * tree is kept small since every node costs SRAM. Any call
+ * stacks we have no room for are charged to their parent.
+ */
+#define PROFILE_MAX_NODES 48
+#define PROFILE_ROOT      0
+#define PROFILE_NO_NODE   0xff
+
+typedef struct {
+	void*    fn;
+	uint8_t  parent;
+	uint32_t cycles;
+} ProfileNode;
+
+static ProfileNode       nodes[PROFILE_MAX_NODES];
+static uint8_t           nodeCount;
+static uint8_t           currentNode;
+static uint8_t           overflowDepth; /* calls we are not keeping track of */
+static uint8_t           enabled;
+static uint32_t          lastTime;
+static volatile uint16_t timer5Overflows;
+
+ISR(TIMER5_OVF_vect)
+{
+	timer5Overflows++;
+}
+
+static uint32_t NO_INSTRUMENT profileCycles(void)
+{
+	uint16_t high, low;
+	uint8_t  oldSREG = SREG;
+
+	/* As with micros() in wiring.c, an overflow may
+	 * be pending while we read so we account for it. */
+	cli();
+	low  = TCNT5;
+	high = timer5Overflows;
+	if((TIFR5 & (1 << TOV5)) && low < 0x8000){
+		high++;
+	}
+	SREG = oldSREG;
+
+	return ((uint32_t)high << 16) | low;
+}
+
+void NO_INSTRUMENT profileInit(void)
+{
+	/* Normal counting mode with no prescaler - init() in
+	 * wiring.c sets timer 5 up for PWM which we don't use. */
+	TCCR5A = 0;
+	TCCR5B = (1 << CS50);
+	TCNT5  = 0;
+	TIMSK5 = (1 << TOIE5);
+
+	nodes[PROFILE_ROOT].fn     = 0;
+	nodes[PROFILE_ROOT].parent = PROFILE_NO_NODE;
+	nodes[PROFILE_ROOT].cycles = 0;
+	nodeCount     = 1;
+	currentNode   = PROFILE_ROOT;
+	overflowDepth = 0;
+
+	lastTime = profileCycles();
+	enabled  = 1;
+}
+
+/*
+ * Charges the time since the last hook to the current call
+ * stack. The hooks stop the clock as soon as they are entered
+ * and restart it as they leave so that the profiler's own
+ * overhead is (mostly) not counted.
+ */
+static void NO_INSTRUMENT profileCharge(void)
+{
+	nodes[currentNode].cycles += profileCycles() - lastTime;
+}
+
+void NO_INSTRUMENT __cyg_profile_func_enter(void* fn, void* caller)
+{
+	uint8_t i;
+
+	if(!enabled){
+		return;
+	}
+	profileCharge();
+
+	if(overflowDepth > 0){
+		overflowDepth++;
+	}else{
+		/* Look for this function amongst the children of the
+		 * current node, otherwise add it as a new child. */
+		for(i=1; i<nodeCount; i++){
+			if(nodes[i].parent == currentNode && nodes[i].fn == fn){
+				break;
+			}
+		}
+
+		if(i == nodeCount){
+			if(nodeCount < PROFILE_MAX_NODES){
+				nodes[i].fn     = fn;
+				nodes[i].parent = currentNode;
+				nodes[i].cycles = 0;
+				nodeCount++;
+			}else{
+				i = currentNode;
+				overflowDepth = 1;
+			}
+		}
+		currentNode = i;
+	}
+
+	lastTime = profileCycles();
+}
+
+void NO_INSTRUMENT __cyg_profile_func_exit(void* fn, void* caller)
+{
+	if(!enabled){
+		return;
+	}
+	profileCharge();
+
+	if(overflowDepth > 0){
+		overflowDepth--;
+	}else if(currentNode != PROFILE_ROOT){
+		currentNode = nodes[currentNode].parent;
+	}
+
+	lastTime = profileCycles();
+}
+
+static void NO_INSTRUMENT profilePrintStack(uint8_t node)
+{
+	if(nodes[node].parent != PROFILE_ROOT){
+		profilePrintStack(nodes[node].parent);
+		uartPutChar(';');
+	}
+
+	/* Function pointers on the AVR are word addresses,
+	 * addr2line and the map file use byte addresses. */
+	uartPrint("0x");
+	uartPrintHex((uint16_t)nodes[node].fn << 1);
+}
+
+void NO_INSTRUMENT profileDump(void)
+{
+	uint8_t i;
+
+	/* Printing is slow, so we pause profiling rather than
+	 * have it show up as time spent in the caller. */
+	enabled = 0;
+
+	for(i=1; i<nodeCount; i++){
+		if(nodes[i].cycles == 0){
+			continue;
+		}
+		profilePrintStack(i);
+		uartPutChar(' ');
+		uartPrintNumber(nodes[i].cycles);
+		uartPrint("\r\n");
+		nodes[i].cycles = 0;
+	}
+	uartPrint("\r\n");
+
+	lastTime = profileCycles();
+	enabled  = 1;
+}
+
+#endif
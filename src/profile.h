@@ -0,0 +1,17 @@
+#ifndef profileh
+#define profileh
+
+/*
+ * The profiler only exists when building with PROFILE_FUNCTIONS
+ * defined (and main.c, lcd.c, input.c and script.c compiled
+ * with -finstrument-functions), otherwise these calls vanish.
+ */
+#ifdef PROFILE_FUNCTIONS
+void profileInit(void);
+void profileDump(void);
+#else
+#define profileInit()
+#define profileDump()
+#endif
+
+#endif
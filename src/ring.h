@@ -0,0 +1,87 @@
+#ifndef ringh
+#define ringh
+
+/*
+ * A ring buffer of bytes for passing data between an interrupt
+ * and the main loop, with exactly one side putting bytes in and
+ * the other taking them out.
+ *
+ * head is only ever written by the side putting bytes in and
+ * tail only by the side taking them out, and as each is a
+ * single byte the AVR always reads and writes them whole - so
+ * neither side ever needs to disable interrupts. Both count
+ * up forever (wrapping around at 256) and are masked down to
+ * an index into data, so 'head - tail' is always the number
+ * of bytes waiting. For this to work the size of data must be
+ * a power of 2, and at most 128 so that a full ring can be
+ * told apart from an empty one.
+ *
+ * e.g.
+ *   static uint8_t txData[64];
+ *   static Ring    tx = RING_INIT(txData);
+ */
+typedef struct {
+	volatile uint8_t head;  /* written only when putting bytes in */
+	volatile uint8_t tail;  /* written only when taking bytes out */
+	uint8_t          mask;  /* size of data - 1 */
+	uint8_t*         data;
+} Ring;
+
+/* The size check makes the build fail (with a negative array size)
+ * for a buffer whose size is not a power of 2 no more than 128. */
+#define RING_SIZE_OK(buffer) \
+	((sizeof(buffer) & (sizeof(buffer) - 1)) == 0 && sizeof(buffer) <= 128)
+
+#define RING_INIT(buffer)  { \
+	0, 0, \
+	sizeof(buffer) - 1 + 0 * sizeof(char[RING_SIZE_OK(buffer) ? 1 : -1]), \
+	buffer \
+}
+
+/* Stops the compiler moving reads or writes of data past the
+ * update of head or tail, the AVR itself never reorders them. */
+#define RING_BARRIER()     __asm__ __volatile__("" ::: "memory")
+
+static inline uint8_t ringCount(Ring* ring)
+{
+	return (uint8_t)(ring->head - ring->tail);
+}
+
+static inline uint8_t ringFull(Ring* ring)
+{
+	return ringCount(ring) > ring->mask;
+}
+
+/* Returns 0 (and drops the byte) if the ring is full */
+static inline uint8_t ringPut(Ring* ring, uint8_t value)
+{
+	uint8_t head = ring->head;
+
+	if((uint8_t)(head - ring->tail) > ring->mask){
+		return 0;
+	}
+
+	ring->data[head & ring->mask] = value;
+	RING_BARRIER();
+	ring->head = head + 1;
+
+	return 1;
+}
+
+/* Returns 0 (leaving value alone) if the ring is empty */
+static inline uint8_t ringGet(Ring* ring, uint8_t* value)
+{
+	uint8_t tail = ring->tail;
+
+	if(tail == ring->head){
+		return 0;
+	}
+
+	*value = ring->data[tail & ring->mask];
+	RING_BARRIER();
+	ring->tail = tail + 1;
+
+	return 1;
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+  rle.c - this file is responsible for decompressing images
+  (and other assets) that are kept compressed in program memory
+  so that more of them fit into flash.
+
+  The images are 1-bit page layout bytes (as in the frame buffer)
+  which are very often all clear (0x00) or all set (0xff), so we
+  use a simple run length encoding tuned for this. Each run starts
+  with a control byte, the top 2 bits give the kind of run and the
+  bottom 6 bits give its length less one (i.e. 1 to 64 bytes):
+
+    00xxxxxx  literal - the next length bytes are copied as is
+    01xxxxxx  length bytes of 0x00
+    10xxxxxx  length bytes of 0xff
+    11xxxxxx  the next byte repeated length times
+
+  The data is produced by tools/pbm2c (with -z). There is no end
+  marker, the caller must know how many bytes to read.
+
+  Decoding is streamed, so a whole image never needs to be held
+  in SRAM: rleNext hands out one byte at a time (e.g. to send
+  straight to the LCD) and rleRead fills a buffer of any length
+  (e.g. one page of the frame buffer), and the two may be mixed.
+
+  When building with RLE_BENCH defined, rleReport times decoding
+  the splash screen with each of the two and prints the cost in
+  cycles per byte over serial.
+*/
+#include <WProgram.h>
+#include <avr/pgmspace.h>
+#include "uart.h"
+#include "rle.h"
+
+#ifdef RLE_BENCH
+extern volatile       unsigned char                              framebuffer[];
+extern volatile const unsigned char __attribute__((__progmem__)) SPLASH[];
+#endif
+
+#define RLE_LITERAL 0x00
+#define RLE_ZEROS   0x40
+#define RLE_ONES    0x80
+#define RLE_REPEAT  0xc0
+
+void rleBegin(RleStream* stream, const unsigned char* data)
+{
+	stream->next  = data;
+	stream->count = 0;
+}
+
+/* Reads the control byte (and value) of the next run */
+static void rleFetch(RleStream* stream)
+{
+	uint8_t control = pgm_read_byte(stream->next++);
+
+	stream->count   = (control & 0x3f) + 1;
+	stream->literal = 0;
+
+	switch(control & 0xc0){
+		case RLE_LITERAL: stream->literal = 1;                                break;
+		case RLE_ZEROS:   stream->value   = 0x00;                             break;
+		case RLE_ONES:    stream->value   = 0xff;                             break;
+		default:          stream->value   = pgm_read_byte(stream->next++);    break;
+	}
+}
+
+uint8_t rleNext(RleStream* stream)
+{
+	if(stream->count == 0){
+		rleFetch(stream);
+	}
+	stream->count--;
+
+	return stream->literal ? pgm_read_byte(stream->next++) : stream->value;
+}
+
+void rleRead(RleStream* stream, volatile unsigned char* buffer, uint16_t length)
+{
+	uint8_t n;
+
+	/* Rather than going through rleNext for every byte, we
+	 * copy or fill as much of each run as we can in one go.
+	 */
+	while(length > 0){
+		if(stream->count == 0){
+			rleFetch(stream);
+		}
+
+		n = stream->count;
+		if(n > length){
+			n = length;
+		}
+		stream->count -= n;
+		length        -= n;
+
+		if(stream->literal){
+			while(n--){
+				*buffer++ = pgm_read_byte(stream->next++);
+			}
+		}else{
+			while(n--){
+				*buffer++ = stream->value;
+			}
+		}
+	}
+}
+
+#ifdef RLE_BENCH
+
+static void rlePrintRate(const char* name, unsigned long time, uint16_t length)
+{
+	uartPrint("rle: ");
+	uartPrint(name);
+	uartPrint(" ");
+	uartPrintNumber(time * (F_CPU / 1000000UL) / length);
+	uartPrint(" cycles/byte\r\n");
+}
+
+/*
+ * rleReport decodes the splash screen into framebuffer twice, once
+ * with rleRead and once a byte at a time with rleNext, and prints
+ * how many cycles each took per byte. micros() only counts in 4us
+ * steps, so a whole screen is used to make each take a few ms.
+ * Whatever was in framebuffer is lost.
+ */
+void rleReport(void)
+{
+	RleStream     stream;
+	unsigned long start, time;
+	uint16_t      i;
+
+	rleBegin(&stream, (const unsigned char*)SPLASH);
+	start = micros();
+	rleRead(&stream, framebuffer, 1024);
+	time  = micros() - start;
+	rlePrintRate("rleRead", time, 1024);
+
+	rleBegin(&stream, (const unsigned char*)SPLASH);
+	start = micros();
+	for(i=0; i<1024; i++){
+		framebuffer[i] = rleNext(&stream);
+	}
+	time  = micros() - start;
+	rlePrintRate("rleNext", time, 1024);
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef rleh
+#define rleh
+
+/* The state of a stream being decompressed, see rle.c */
+typedef struct {
+	const unsigned char* next;    /* the next compressed byte (in program memory) */
+	uint8_t              count;   /* bytes left in the current run */
+	uint8_t              value;   /* the byte being repeated, when not a literal run */
+	uint8_t              literal;
+} RleStream;
+
+void    rleBegin(RleStream* stream, const unsigned char* data);
+uint8_t rleNext (RleStream* stream);
+void    rleRead (RleStream* stream, volatile unsigned char* buffer, uint16_t length);
+
+/*
+ * The decoding benchmark only exists when building with
+ * RLE_BENCH defined, otherwise this call vanishes.
+ */
+#ifdef RLE_BENCH
+void    rleReport(void);
+#else
+#define rleReport()
+#endif
+
+#endif
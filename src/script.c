@@ -0,0 +1,120 @@
+/*
+  script.c - this file is responsible for running the small
+  scripts which drive the aliens (how they march, when they
+  drop down and how often they fire), so that new attack
+  patterns and waves can be made by writing a new script in
+  data.c rather than changing the game logic in main.c.
+
+  A script is a list of instructions (see script.h) kept in
+  program memory. Each entity following a script keeps its
+  place in it, and once every frame scriptRun carries on from
+  there until the script waits for a later frame.
+
+  To stop a runaway script (say, a jump back to itself without
+  a wait) from holding up the whole frame, no entity is allowed
+  to run more than SCRIPT_MAX_STEPS instructions a frame - after
+  that it simply carries on from where it got to next frame.
+  This way each entity costs at most a fixed amount of time.
+*/
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "script.h"
+
+void scriptStart(ScriptEntity* entity, const unsigned char* script)
+{
+	entity->script  = script;
+	entity->pc      = 0;
+	entity->wait    = 0;
+	entity->counter = 0;
+}
+
+void scriptRun(ScriptEntity* entity, Formation* formation)
+{
+	/*
+	 * Rather than a switch statement, each instruction jumps
+	 * straight to the code for the next one through this table
+	 * of labels (a GCC extension). This saves the range check
+	 * and the jump back to the top of a loop a switch would
+	 * need for every instruction.
+	 *
+	 * Like the scripts, the table is kept in program memory
+	 * rather than being copied into SRAM at reset - reading
+	 * an entry back with pgm_read_word costs only a couple of
+	 * cycles more than from SRAM would.
+	 */
+	static void* const __attribute((__progmem__)) instructions[] = {
+		&&op_end, &&op_wait, &&op_jump, &&op_repeat, &&op_march,
+		&&op_bounce, &&op_drop, &&op_fire, &&op_set_speed
+	};
+
+	const unsigned char* script = entity->script;
+	uint8_t              pc     = entity->pc;
+	uint8_t              steps  = SCRIPT_MAX_STEPS;
+
+	#define OPERAND(n)   pgm_read_byte(script + pc + (n))
+	#define DISPATCH()   goto *(void*)pgm_read_word(&instructions[pgm_read_byte(script + pc)])
+	#define NEXT(size)   { pc += (size); if(--steps == 0) goto done; DISPATCH(); }
+
+	if(entity->wait > 0){
+		if(--entity->wait > 0){
+			return;
+		}
+	}
+
+	DISPATCH();
+
+op_end:
+	/* We stay on this instruction forever */
+	goto done;
+
+op_wait:
+	entity->wait = OPERAND(1);
+	pc += 2;
+	goto done;
+
+op_jump:
+	pc = OPERAND(1);
+	NEXT(0);
+
+op_repeat:
+	/* The counter counts down the times we have left to jump
+	 * back, 0 meaning we have not yet started repeating. */
+	if(entity->counter == 0){
+		entity->counter = OPERAND(1) + 1;
+	}
+	if(--entity->counter > 0){
+		pc = OPERAND(2);
+		NEXT(0);
+	}
+	NEXT(3);
+
+op_march:
+	formation->x += formation->dx;
+	NEXT(1);
+
+op_bounce:
+	if(formation->hitEdge){
+		formation->dx  = -formation->dx * OPERAND(2) / OPERAND(3);
+		formation->y  += OPERAND(1);
+	}
+	NEXT(4);
+
+op_drop:
+	formation->y += OPERAND(1);
+	NEXT(2);
+
+op_fire:
+	formation->fire = 1;
+	NEXT(1);
+
+op_set_speed:
+	formation->dx = (int8_t)OPERAND(1) / 8.0f;
+	NEXT(2);
+
+done:
+	entity->pc = pc;
+
+	#undef OPERAND
+	#undef DISPATCH
+	#undef NEXT
+}
@@ -0,0 +1,65 @@
+#ifndef scripth
+#define scripth
+
+/*
+ * The alien formation, which scripts move around and
+ * decide when to fire for. The game sets hitEdge while
+ * drawing if any alien touches the side of the screen,
+ * and fires whenever a script has set fire.
+ */
+typedef struct {
+	float   x, y;
+	float   dx;
+	uint8_t hitEdge;
+	uint8_t fire;
+} Formation;
+
+/* Each entity being driven by a script needs only these
+ * few bytes of SRAM, the script itself is in program memory */
+typedef struct {
+	const unsigned char* script;
+	uint8_t              pc;      /* offset of the next instruction in script */
+	uint8_t              wait;    /* frames left before we carry on */
+	uint8_t              counter; /* for SCRIPT_REPEAT */
+} ScriptEntity;
+
+/* Instructions */
+#define OP_END           0
+#define OP_WAIT          1
+#define OP_JUMP          2
+#define OP_REPEAT        3
+#define OP_MARCH         4
+#define OP_BOUNCE        5
+#define OP_DROP          6
+#define OP_FIRE          7
+#define OP_SET_SPEED     8
+
+/*
+ * These macros are used to write the scripts, e.g.
+ *
+ *   volatile const unsigned char __attribute((__progmem__)) SCRIPT[]={
+ *     / * 0 * / SCRIPT_MARCH(),
+ *     / * 1 * / SCRIPT_WAIT(1),
+ *     / * 3 * / SCRIPT_JUMP(0)
+ *   };
+ *
+ * Jumps are to the offset (in bytes) of an instruction from the
+ * start of the script, so it's best to note these as above.
+ */
+#define SCRIPT_END()                  OP_END                           /* stop for good */
+#define SCRIPT_WAIT(frames)           OP_WAIT,      (frames)           /* carry on after this many frames */
+#define SCRIPT_JUMP(to)               OP_JUMP,      (to)
+#define SCRIPT_REPEAT(times, to)      OP_REPEAT,    (times), (to)      /* jump back 'times' times, then carry on */
+#define SCRIPT_MARCH()                OP_MARCH                         /* move by the formation's speed */
+#define SCRIPT_BOUNCE(down, num, den) OP_BOUNCE,    (down), (num), (den) /* if at an edge turn around, move down and speed up by num/den */
+#define SCRIPT_DROP(down)             OP_DROP,      (down)             /* move down */
+#define SCRIPT_FIRE()                 OP_FIRE                          /* have one of the aliens fire */
+#define SCRIPT_SET_SPEED(eighths)     OP_SET_SPEED, ((eighths) & 0xff) /* set the speed (signed, in 1/8 pixels per frame) */
+
+/* The most instructions an entity may run in a single frame */
+#define SCRIPT_MAX_STEPS 8
+
+void scriptStart(ScriptEntity* entity, const unsigned char* script);
+void scriptRun  (ScriptEntity* entity, Formation* formation);
+
+#endif
@@ -0,0 +1,75 @@
+/*
+  stack.c - this file is responsible for keeping an eye on how
+  much SRAM the stack has used, so that we know how much room
+  there is left for larger buffers (the framebuffer alone takes
+  1KB of the Mega's 8KB).
+
+  At reset, before the C runtime has even set up the stack, we
+  fill ('paint') all of the memory between the end of our
+  variables (.data and .bss) and the top of the stack with a
+  known value. Any byte the stack has ever grown into will have
+  been overwritten, so by counting how many bytes of paint are
+  left we get the stack's high-water mark.
+
+  Note that this assumes malloc is never used (it isn't), as the
+  heap would grow into the same region.
+*/
+#include <avr/io.h>
+#include "uart.h"
+#include "stack.h"
+
+#define STACK_PAINT 0xc5
+
+/* Provided by the linker: the end of .bss and the top of SRAM */
+extern uint8_t _end;
+extern uint8_t __stack;
+
+void stackPaint(void) __attribute__((__naked__, __used__, __section__(".init1")));
+
+/*
+ * The painting must be done in assembly, as in .init1 the
+ * C runtime has not yet cleared r1 (the register the compiler
+ * assumes is always zero) - this is also why it is 'naked', we
+ * just fall through into the next .init section.
+ */
+void stackPaint(void)
+{
+	__asm__ __volatile__ (
+		"    ldi r30, lo8(_end)        \n"
+		"    ldi r31, hi8(_end)        \n"
+		"    ldi r24, %0               \n"
+		"    ldi r25, hi8(__stack)     \n"
+		"    rjmp 2f                   \n"
+		"1:  st  Z+, r24               \n"
+		"2:  cpi r30, lo8(__stack)     \n"
+		"    cpc r31, r25              \n"
+		"    brlo 1b                   \n"
+		"    breq 1b                   \n"
+		: : "i" (STACK_PAINT)
+	);
+}
+
+/*
+ * Returns the number of bytes between the end of our variables
+ * and the deepest the stack has ever reached.
+ */
+uint16_t stackUnused(void)
+{
+	const uint8_t* p = &_end;
+	uint16_t       count = 0;
+
+	while(*p == STACK_PAINT && p <= &__stack){
+		p++;
+		count++;
+	}
+	return count;
+}
+
+void stackReport(void)
+{
+	uartPrint("stack: ");
+	uartPrintNumber(stackUnused());
+	uartPrint(" bytes never used, ");
+	uartPrintNumber((uint16_t)&__stack - (uint16_t)&_end + 1);
+	uartPrint(" bytes free for stack\r\n");
+}
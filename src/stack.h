@@ -0,0 +1,7 @@
+#ifndef stackh
+#define stackh
+
+uint16_t stackUnused(void);
+void     stackReport(void);
+
+#endif
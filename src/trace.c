@@ -0,0 +1,124 @@
+/*
+  trace.c - this file is responsible for recording a timeline
+  of the phases of each frame (input, update, lcdClear,
+  lcdRepaint and each of its pages, and the idle delay) so that
+  the frames where we slip past our FRAME_BUDGET (see gamedefs.h)
+  can be found.
+
+  Enabled by defining TRACE_PHASES. Events are kept in a small
+  ring buffer which always holds the most recent events, and
+  traceDump prints them over serial as Chrome trace JSON, which
+  can be saved to a file and opened in chrome://tracing or
+  https://ui.perfetto.dev directly.
+*/
+#ifdef TRACE_PHASES
+
+#include <WProgram.h>
+#include <avr/pgmspace.h>
+#include "uart.h"
+#include "trace.h"
+
+/*
+ * Each event is 3 bytes: the event byte (phase plus the
+ * begin/end bit) and the time it happened. To keep this
+ * compact the time is micros()/4 (micros() only has a 4us
+ * resolution anyway) truncated to 16 bits. This wraps every
+ * 262ms, which is far longer than any one phase of a frame
+ * takes, so when dumping we can rebuild the full time line
+ * by summing the differences between events.
+ *
+ * There are exactly 256 events in the ring, this way an
+ * 8-bit index wraps around the ring by itself.
+ */
+#define TRACE_EVENTS 256
+
+static uint8_t  traceEvent[TRACE_EVENTS];
+static uint16_t traceTime [TRACE_EVENTS];
+static uint8_t  traceHead;
+static uint8_t  traceFull;
+static uint8_t  tracePaused;
+
+volatile const char __attribute((__progmem__)) TRACE_NAME_INPUT  [] = { "input"      };
+volatile const char __attribute((__progmem__)) TRACE_NAME_UPDATE [] = { "update"     };
+volatile const char __attribute((__progmem__)) TRACE_NAME_CLEAR  [] = { "lcdClear"   };
+volatile const char __attribute((__progmem__)) TRACE_NAME_REPAINT[] = { "lcdRepaint" };
+volatile const char __attribute((__progmem__)) TRACE_NAME_IDLE   [] = { "idle"       };
+volatile const char __attribute((__progmem__)) TRACE_NAME_PAGE   [] = { "page"       };
+
+void traceRecord(uint8_t event)
+{
+	if(tracePaused){
+		return;
+	}
+
+	traceEvent[traceHead] = event;
+	traceTime [traceHead] = (uint16_t)(micros() >> 2);
+
+	if(++traceHead == 0){
+		traceFull = 1;
+	}
+}
+
+static void tracePrintName(uint8_t phase)
+{
+	const char* name;
+
+	switch(phase){
+		case TRACE_INPUT:   name = (const char*)TRACE_NAME_INPUT;   break;
+		case TRACE_UPDATE:  name = (const char*)TRACE_NAME_UPDATE;  break;
+		case TRACE_CLEAR:   name = (const char*)TRACE_NAME_CLEAR;   break;
+		case TRACE_REPAINT: name = (const char*)TRACE_NAME_REPAINT; break;
+		case TRACE_IDLE:    name = (const char*)TRACE_NAME_IDLE;    break;
+		default:            name = (const char*)TRACE_NAME_PAGE;    break;
+	}
+	uartPrint_P(name);
+
+	/* Pages are named after the IC and page, e.g. "page1.3" */
+	if(phase >= TRACE_PAGE){
+		phase -= TRACE_PAGE;
+		uartPutChar('1' + (phase >> 3));
+		uartPutChar('.');
+		uartPutChar('0' + (phase & 0x07));
+	}
+}
+
+void traceDump(void)
+{
+	uint8_t  i;
+	uint16_t k, count;
+	uint16_t last;
+	uint32_t now; /* in micros()/4 units since the oldest event */
+
+	tracePaused = 1;
+
+	/* The oldest event is at the head once the ring has filled */
+	i     = traceFull ? traceHead    : 0;
+	count = traceFull ? TRACE_EVENTS : traceHead;
+	last  = traceTime[i];
+	now   = 0;
+
+	uartPrint("[\r\n");
+	for(k=0; k<count; k++, i++){
+		now  += (uint16_t)(traceTime[i] - last);
+		last  = traceTime[i];
+
+		uartPrint("{\"name\":\"");
+		tracePrintName(traceEvent[i] & ~TRACE_BEGIN);
+		uartPrint("\",\"ph\":\"");
+		uartPutChar((traceEvent[i] & TRACE_BEGIN) ? 'B' : 'E');
+		uartPrint("\",\"ts\":");
+		uartPrintNumber(now << 2);
+		uartPrint(",\"pid\":0,\"tid\":0}");
+		if(k + 1 < count){
+			uartPutChar(',');
+		}
+		uartPrint("\r\n");
+	}
+	uartPrint("]\r\n");
+
+	traceHead   = 0;
+	traceFull   = 0;
+	tracePaused = 0;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef traceh
+#define traceh
+
+/* Phases which may be traced, the LCD pages follow on from
+ * TRACE_PAGE (i.e. TRACE_PAGE + 0 to TRACE_PAGE + 15 for the
+ * 8 pages of each of the two ICs). */
+#define TRACE_INPUT     0
+#define TRACE_UPDATE    1
+#define TRACE_CLEAR     2
+#define TRACE_REPAINT   3
+#define TRACE_IDLE      4
+#define TRACE_PAGE      5
+
+#define TRACE_BEGIN     0x80
+#define TRACE_END       0x00
+
+/*
+ * The trace recorder only exists when building with TRACE_PHASES
+ * defined, otherwise these calls vanish.
+ */
+#ifdef TRACE_PHASES
+void traceRecord(uint8_t event);
+void traceDump(void);
+#define traceBegin(x)   { traceRecord((x) | TRACE_BEGIN); }
+#define traceEnd(x)     { traceRecord((x) | TRACE_END  ); }
+#else
+#define traceBegin(x)
+#define traceEnd(x)
+#define traceDump()
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+/*
+  uart.c - this file is responsible for providing a
+  very small serial output used for diagnostics (profiling
+  dumps, timing reports and the like) - the game itself
+  never needs it.
+
+  Note the following pins are used and their purposes
+  listed:
+
+  Pins E0 and E1 are USART0's RX and TX lines, which on
+   the Mega are also wired to the USB serial converter.
+   (Port D is entirely taken up by the LCD data-bus so
+   we cannot use USART1 there.)
+
+  Note that wiring.c's init function disconnects the USART
+  from its pins, as such uartInit must be called after init.
+
+  Bytes are queued in uartTx and sent by the USART's data
+  register empty interrupt, so printing only has to wait when
+  more than UART_TX_SIZE bytes are waiting to go out. As such
+  nothing should print while interrupts are disabled.
+*/
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include "ring.h"
+#include "uart.h"
+
+/* setbaud.h works out the baud rate register's value (rounded
+ * to the nearest, rather than truncated) and whether double
+ * speed mode (U2X0) is needed to keep the error within 2%. At
+ * 16MHz and 57600 baud it is: normal mode would be 2.1% fast,
+ * double speed with 34 is 0.8% slow. */
+#define BAUD UART_BAUD
+#include <util/setbaud.h>
+
+static uint8_t uartTxData[UART_TX_SIZE];
+static Ring    uartTx = RING_INIT(uartTxData);
+
+void uartInit(void)
+{
+	UBRR0H = UBRRH_VALUE;
+	UBRR0L = UBRRL_VALUE;
+#if USE_2X
+	UCSR0A = (1 << U2X0);
+#else
+	UCSR0A = 0;
+#endif
+
+	/* Transmit only, 8 data bits, no parity and 1 stop bit */
+	UCSR0B = (1 << TXEN0);
+	UCSR0C = (1 << UCSZ01) | (1 << UCSZ00);
+}
+
+/*
+ * Each time the USART is ready for another byte we give it the
+ * next one waiting, once there are none left we turn this
+ * interrupt off until uartPutChar has some more.
+ */
+ISR(USART0_UDRE_vect)
+{
+	uint8_t c;
+
+	if(ringGet(&uartTx, &c)){
+		UDR0 = c;
+	}else{
+		UCSR0B &= ~(1 << UDRIE0);
+	}
+}
+
+void uartPutChar(char c)
+{
+	/* If the queue is full we wait for the interrupt to
+	 * make some room, so long dumps still block - nothing
+	 * timing critical should be printing a lot.
+	 */
+	while(!ringPut(&uartTx, c)){
+		/* wait for a byte to be sent */
+	}
+
+	/* Should the interrupt turn itself off between ringPut
+	 * and here, this simply turns it back on to send the
+	 * byte we just queued - so there is no need to disable
+	 * interrupts around this. */
+	UCSR0B |= (1 << UDRIE0);
+}
+
+void uartPrint(const char* text)
+{
+	while(*text){
+		uartPutChar(*text++);
+	}
+}
+
+void uartPrint_P(const char* text)
+{
+	char c;
+
+	while((c = pgm_read_byte(text++)) != '\0'){
+		uartPutChar(c);
+	}
+}
+
+void uartPrintNumber(uint32_t value)
+{
+	char    digits[10]; /* 2^32 - 1 has 10 decimal digits */
+	uint8_t i = 0;
+
+	do{
+		digits[i++] = '0' + (value % 10);
+		value /= 10;
+	}while(value != 0);
+
+	while(i > 0){
+		uartPutChar(digits[--i]);
+	}
+}
+
+void uartPrintHex(uint16_t value)
+{
+	int8_t  i;
+	uint8_t nibble;
+
+	for(i=12; i>=0; i-=4){
+		nibble = (value >> i) & 0x0f;
+		uartPutChar(nibble < 10 ? '0' + nibble : 'a' + nibble - 10);
+	}
+}
@@ -0,0 +1,14 @@
+#ifndef uarth
+#define uarth
+
+#define UART_BAUD 57600
+#define UART_TX_SIZE 64 /* bytes waiting to be sent, must be a power of 2 no more than 128 */
+
+void uartInit(void);
+void uartPutChar(char c);
+void uartPrint(const char* text);
+void uartPrint_P(const char* text); /* text must be stored in program memory */
+void uartPrintNumber(uint32_t value);
+void uartPrintHex(uint16_t value);
+
+#endif
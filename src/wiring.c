@@ -23,6 +23,7 @@
 */
 
 #include "wiring_private.h"
+#include "latency.h"
 
 // the prescaler is set so that timer0 ticks every 64 clock cycles, and the
 // the overflow handler is called every 256 ticks.
@@ -45,8 +46,13 @@ SIGNAL(TIMER0_OVF_vect)
 {
 	// copy these to local variables so they can be stored in registers
 	// (volatile variables must be read from memory on every access)
-	unsigned long m = timer0_millis;
-	unsigned char f = timer0_fract;
+	unsigned long m;
+	unsigned char f;
+
+	latencyIsrEnter();
+
+	m = timer0_millis;
+	f = timer0_fract;
 
 	m += MILLIS_INC;
 	f += FRACT_INC;
@@ -58,6 +64,8 @@ SIGNAL(TIMER0_OVF_vect)
 	timer0_fract = f;
 	timer0_millis = m;
 	timer0_overflow_count++;
+
+	latencyIsrExit();
 }
 
 unsigned long millis()
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# flamesyms.sh - replaces the addresses in profileDump's output
+# (see src/profile.c) with function names, ready for flamegraph.pl.
+#
+# Usage: flamesyms.sh firmware.elf [capture.txt] > stacks.txt
+#        flamegraph.pl stacks.txt > profile.svg
+#
+# capture.txt is whatever was captured from the serial port (or
+# standard input if not given), any lines which are not collapsed
+# stacks (boot times, trace output and so on) are skipped. The elf
+# must be the one built with PROFILE_FUNCTIONS that was running.
+# Addresses avr-addr2line cannot place are left as they are.
+
+ADDR2LINE=${AVR_ADDR2LINE:-avr-addr2line}
+
+if [ $# -lt 1 ]; then
+	echo "usage: $0 firmware.elf [capture.txt]" >&2
+	exit 1
+fi
+
+ELF=$1
+INPUT=${2:-/dev/stdin}
+STACKS=${TMPDIR:-/tmp}/flamesyms.$$
+trap 'rm -f "$STACKS" "$STACKS.names"' EXIT
+
+# Serial captures usually come with \r\n line endings
+tr -d '\r' < "$INPUT" | grep -E '^0x[0-9a-f]+(;0x[0-9a-f]+)* [0-9]+$' > "$STACKS"
+
+# Every distinct address, looked up in one go (-f gives the
+# function name on one line and file:line on the next)
+ADDRS=$(cut -d' ' -f1 "$STACKS" | tr ';' '\n' | sort -u)
+[ -n "$ADDRS" ] || exit 0
+
+$ADDR2LINE -f -e "$ELF" $ADDRS | awk 'NR % 2 == 1' > "$STACKS.names"
+
+printf '%s\n' "$ADDRS" | paste -d' ' - "$STACKS.names" | awk '
+	NR == FNR {
+		if($2 != "??"){
+			name[$1] = $2
+		}
+		next
+	}
+	{
+		n = split($1, frames, ";")
+		out = ""
+		for(i=1; i<=n; i++){
+			f = (frames[i] in name) ? name[frames[i]] : frames[i]
+			out = (i == 1) ? f : out ";" f
+		}
+		print out, $2
+	}' - "$STACKS"
@@ -0,0 +1,20 @@
+/*
+  WProgram.h - a stand-in for the Arduino core's header for the
+  host test programs in tools, which provide these functions
+  themselves (so that, for instance, time can be made to pass
+  as fast as a test needs it to).
+*/
+#ifndef hostwprogramh
+#define hostwprogramh
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+
+unsigned long millis(void);
+unsigned long micros(void);
+void          delay(unsigned long ms);
+void          delayMicroseconds(unsigned int us);
+
+#endif
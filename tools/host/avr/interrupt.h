@@ -0,0 +1,14 @@
+/*
+  avr/interrupt.h - a stand-in for avr-libc's header for the host
+  test programs in tools. An interrupt handler becomes a plain
+  function, which the test program calls whenever its model
+  says the interrupt would happen.
+*/
+#ifndef hostinterrupth
+#define hostinterrupth
+
+#define ISR(vector)  void vector(void)
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,41 @@
+/*
+  avr/io.h - a stand-in for avr-libc's header, only for building
+  parts of the firmware into the host (PC) test programs in
+  tools. Only the registers those programs model are given, so
+  a file touching any other fails to build rather than quietly
+  doing nothing.
+
+  The port registers are plain variables. The SPI's registers
+  are each reached through a function (which the test program
+  provides) every time they are used, so that a model of the
+  SPI sees each access as it happens - e.g. oledtest.c takes a
+  read of SPSR as the firmware waiting for the byte it wrote
+  to SPDR to go out.
+*/
+#ifndef hostioh
+#define hostioh
+
+#include <stdint.h>
+
+extern volatile uint8_t PORTB, DDRB, PINB;
+extern volatile uint8_t PORTC, DDRC, PINC;
+extern volatile uint8_t PORTD, DDRD, PIND;
+
+volatile uint8_t* hostSpcr(void);
+volatile uint8_t* hostSpsr(void);
+volatile uint8_t* hostSpdr(void);
+
+#define SPCR    (*hostSpcr())
+#define SPSR    (*hostSpsr())
+#define SPDR    (*hostSpdr())
+
+/* Bits of SPCR */
+#define SPIE    7
+#define SPE     6
+#define MSTR    4
+
+/* Bits of SPSR */
+#define SPIF    7
+#define SPI2X   0
+
+#endif
@@ -0,0 +1,20 @@
+/*
+  avr/pgmspace.h - a stand-in for avr-libc's header for the host
+  test programs in tools. On the host there is only the one
+  address space, so reading program memory is just reading.
+
+  Note that pgm_read_word keeps the type of what it reads, rather
+  than always giving 16 bits as on the AVR, since pointers (e.g.
+  script.c's table of labels) are wider than that on the host.
+*/
+#ifndef hostpgmspaceh
+#define hostpgmspaceh
+
+#include <stdint.h>
+#include <string.h>
+
+#define pgm_read_byte(p)    (*(const volatile uint8_t*)(p))
+#define pgm_read_word(p)    (*(p))
+#define memcpy_P(d, s, n)   memcpy((d), (const void*)(s), (n))
+
+#endif
@@ -0,0 +1,45 @@
+#!/bin/sh
+#
+# mkassets.sh - regenerates src/assets.c from the art in assets/
+# using pbm2c, and prints the size of each table. This should be
+# run whenever any of the art is changed.
+#
+# Usage: tools/mkassets.sh   (from the top of the repository)
+
+set -e
+
+CC=${HOSTCC:-cc}
+PBM2C=${TMPDIR:-/tmp}/pbm2c.$$
+OUT=src/assets.c
+
+$CC -O2 -o "$PBM2C" tools/pbm2c.c
+trap 'rm -f "$PBM2C" "$OUT.tmp"' EXIT
+
+{
+cat <<'HEADER'
+/*
+ * This file is generated by tools/mkassets.sh from the
+ * art in assets/ - do not edit it by hand.
+ *
+ * The sprites are stored pre-shifted for lcdDrawSprite and
+ * the font is stored the way round lcdPrintText writes it
+ * into the frame buffer (see lcd.c), the small font is
+ * stored without its blank columns for lcdPrintSmallText
+ * (with SMALL_TEXT_INDEX giving the offset and width of
+ * each character). The splash screen is compressed (see
+ * rle.c).
+ */
+
+HEADER
+"$PBM2C" -n TEXT   -f columns -u -m -l "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz." assets/font.pbm
+echo
+"$PBM2C" -n SMALL_TEXT -f proportional -w 5 -u -a 32 assets/font5x7.pbm
+echo
+"$PBM2C" -n ALIEN8 -f shifted -u assets/alien8.pbm
+echo
+"$PBM2C" -n SHIP8  -f shifted -u assets/ship8.pbm
+echo
+"$PBM2C" -n SPLASH -f pages -u -m -z assets/splash.pbm
+} > "$OUT.tmp"
+
+mv "$OUT.tmp" "$OUT"
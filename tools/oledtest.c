@@ -0,0 +1,431 @@
+/*
+  oledtest.c - this is a host (PC) program, not part of the
+  firmware. It builds src/oled.c (with the shared drawing code
+  in src/lcd.c) against a model of the SPI and of an SSD1306
+  panel, so the bytes the driver sends can be checked without
+  the hardware:
+
+    * the SPI model takes each byte written to SPDR as sent
+      once the firmware next looks at the SPI, and calls the
+      transfer complete interrupt for as long as it is turned
+      on, complaining about a byte written while another is
+      still going out or the interrupt being turned on with
+      the transfer complete flag still set (either loses a
+      byte on the real SPI).
+    * the panel model follows the commands sent with the D/C
+      line low (complaining about any it does not know), and
+      puts the data sent with it high into its memory, as the
+      SSD1306 datasheet describes.
+
+  The checks made are that lcdTurnOn leaves the panel set up for
+  a 128x64 screen and blank, that lcdRepaint and lcdShowSplash
+  each send exactly a whole screen, and that what the panel then
+  shows matches what the KS0108 LCD showed for the same frame
+  buffer, and that the splash shows the same way up as it is
+  drawn in assets/splash.pbm.
+
+  Which way up the panel shows its memory depends on how the
+  panel is mounted in its module. This takes the common modules
+  for which 0xa1 and 0xc8 (see OLED_INIT in oled.c) show column
+  0 and row 0 of the memory at the top left, as the popular
+  Arduino libraries for them expect.
+
+  Usage (from the top of the repository):
+
+    cc -O2 -Wno-attributes -DLCD_SSD1306 -Itools/host -Isrc \
+      -o oledtest tools/oledtest.c src/oled.c src/lcd.c \
+      src/rle.c src/assets.c src/data.c
+    ./oledtest
+
+  Prints "ok" and exits with 0 if every check passed.
+*/
+#include <stdio.h>
+#include <WProgram.h>
+#include "lcd.h"
+#include "pins.h"
+
+extern volatile unsigned char framebuffer[];
+void SPI_STC_vect(void);
+
+/* Ports, see tools/host/avr/io.h */
+volatile uint8_t PORTB, DDRB, PINB;
+volatile uint8_t PORTC, DDRC, PINC;
+volatile uint8_t PORTD, DDRD, PIND;
+
+static unsigned long errors;
+static unsigned long now; /* microseconds */
+
+static void check(int test, const char* what)
+{
+	if(!test){
+		printf("%s\n", what);
+		errors++;
+	}
+}
+
+/* Time only passes when asked, so waits end at once */
+unsigned long millis(void)                { return (now += 1000) / 1000; }
+unsigned long micros(void)                { return now += 4; }
+void          delay(unsigned long ms)     { now += ms * 1000; }
+void          delayMicroseconds(unsigned int us) { now += us; }
+
+/* lcdReport's output is not needed */
+void uartPrint(const char* text)          { (void)text;  }
+void uartPrintNumber(uint32_t value)      { (void)value; }
+
+/*
+ * The panel
+ */
+static struct {
+	uint8_t  on, chargePump, mux, offset, startLine, mode, comPins;
+	uint8_t  segRemap, comReverse, inverse, allOn;
+	uint8_t  colStart, colEnd, pageStart, pageEnd, col, page;
+	uint8_t  command[3], have, need; /* a command waiting for its operands */
+	unsigned dataBytes;               /* since the last addressing command */
+	uint8_t  ram[8][128];
+} panel;
+
+/* Operands following each command, or -1 for an unknown command */
+static int operands(uint8_t command)
+{
+	if(command >= 0x40 && command <= 0x7f){
+		return 0; /* start line */
+	}
+	switch(command){
+		case 0xae: case 0xaf: case 0xa0: case 0xa1: case 0xc0: case 0xc8:
+		case 0xa4: case 0xa5: case 0xa6: case 0xa7:
+			return 0;
+		case 0xd5: case 0xa8: case 0xd3: case 0x8d: case 0x20:
+		case 0xda: case 0x81: case 0xd9: case 0xdb:
+			return 1;
+		case 0x21: case 0x22:
+			return 2;
+	}
+	return -1;
+}
+
+static void panelCommand(uint8_t* c)
+{
+	if(c[0] >= 0x40 && c[0] <= 0x7f){
+		panel.startLine = c[0] & 0x3f;
+		return;
+	}
+	switch(c[0]){
+		case 0xae: panel.on         = 0;             break;
+		case 0xaf: panel.on         = 1;             break;
+		case 0xa0: panel.segRemap   = 0;             break;
+		case 0xa1: panel.segRemap   = 1;             break;
+		case 0xc0: panel.comReverse = 0;             break;
+		case 0xc8: panel.comReverse = 1;             break;
+		case 0xa4: panel.allOn      = 0;             break;
+		case 0xa5: panel.allOn      = 1;             break;
+		case 0xa6: panel.inverse    = 0;             break;
+		case 0xa7: panel.inverse    = 1;             break;
+		case 0xa8: panel.mux        = c[1];          break;
+		case 0xd3: panel.offset     = c[1];          break;
+		case 0x8d: panel.chargePump = c[1];          break;
+		case 0x20: panel.mode       = c[1];          break;
+		case 0xda: panel.comPins    = c[1];          break;
+		case 0x21:
+			panel.colStart  = panel.col  = c[1] & 0x7f;
+			panel.colEnd    = c[2] & 0x7f;
+			panel.dataBytes = 0;
+			break;
+		case 0x22:
+			panel.pageStart = panel.page = c[1] & 0x07;
+			panel.pageEnd   = c[2] & 0x07;
+			panel.dataBytes = 0;
+			break;
+		default:
+			break; /* timing and levels, which make no difference here */
+	}
+}
+
+static void panelData(uint8_t data)
+{
+	check(panel.mode == 0x00, "data sent without horizontal addressing");
+
+	panel.ram[panel.page][panel.col] = data;
+	panel.dataBytes++;
+
+	/* Horizontal addressing, the column wraps around to the
+	 * next page and the page back to the first */
+	if(panel.col++ == panel.colEnd){
+		panel.col = panel.colStart;
+		if(panel.page++ == panel.pageEnd){
+			panel.page = panel.pageStart;
+		}
+	}
+}
+
+static void panelReceive(uint8_t byte)
+{
+	int n;
+
+	if(PORTB & (1 << OLED_CS_BIT) || !(DDRB & (1 << OLED_CS_BIT))){
+		check(0, "byte sent with the panel not selected");
+		return;
+	}
+
+	if(PORTC & (1 << OLED_DC_BIT)){
+		check(panel.need == 0, "data sent before a command's operands");
+		panelData(byte);
+		return;
+	}
+
+	if(panel.need == 0){
+		n = operands(byte);
+		if(n < 0){
+			printf("unknown command 0x%02x\n", byte);
+			errors++;
+			return;
+		}
+		panel.have = 0;
+		panel.need = n + 1;
+	}
+
+	panel.command[panel.have++] = byte;
+	if(panel.have == panel.need){
+		panel.need = 0;
+		panelCommand(panel.command);
+	}
+}
+
+/* Whether the pixel at (x, y) on the panel, as seen by the
+ * player, is lit */
+static int panelPixel(int x, int y)
+{
+	int seg = 127 - x, com = 63 - y, col, row;
+
+	/* Undo the remapping of columns and rows (with 0xa1 and 0xc8
+	 * column 0, row 0 is at the top left - see the top of this
+	 * file) */
+	col = panel.segRemap   ? 127 - seg : seg;
+	row = panel.comReverse ? 63  - com : com;
+
+	return panel.allOn || (((panel.ram[row >> 3][col] >> (row & 7)) & 1) ^ panel.inverse);
+}
+
+/* Whether the pixel at (x, y) was lit on the KS0108 LCD (which is
+ * mounted upside down, see lcdDrawPixel) showing framebuffer */
+static int lcdPixel(int x, int y)
+{
+	int col = 127 - x, row = 63 - y;
+
+	return (framebuffer[((row >> 3) << 7) + col] >> (row & 7)) & 1;
+}
+
+/*
+ * The SPI
+ */
+static uint8_t spcr, spsr, spdr;
+static uint8_t spiPending;    /* a byte has been written to SPDR and not yet gone */
+static uint8_t spiFlag;       /* SPIF */
+static uint8_t spiFlagRead;   /* SPSR was read with SPIF set, the next SPDR access clears it */
+static uint8_t spiFlagAtSpcr; /* SPIF the last time SPCR was written */
+
+/* The byte being sent goes out */
+static void spiShift(void)
+{
+	if(spiPending){
+		spiPending  = 0;
+		spiFlag     = 1;
+		spiFlagRead = 0;
+		panelReceive(spdr);
+	}
+}
+
+volatile uint8_t* hostSpcr(void)
+{
+	spiFlagAtSpcr = spiFlag;
+	return &spcr;
+}
+
+volatile uint8_t* hostSpsr(void)
+{
+	spiShift();
+	spiFlagRead = spiFlag;
+	spsr = (spsr & ~(1 << SPIF)) | (spiFlag << SPIF);
+	return &spsr;
+}
+
+/* The firmware only ever writes SPDR */
+volatile uint8_t* hostSpdr(void)
+{
+	check(!spiPending, "SPDR written while the last byte was still going out");
+	if(spiFlagRead){
+		spiFlag     = 0;
+		spiFlagRead = 0;
+	}
+	spiPending = 1;
+	return &spdr;
+}
+
+/* Lets the interrupt send whatever lcdRepaint left it to,
+ * returning the number of times it ran */
+static unsigned spiRunInterrupt(void)
+{
+	unsigned count = 0;
+
+	check(!((spcr & (1 << SPIE)) && spiFlagAtSpcr),
+	      "interrupt turned on with SPIF set, it would run at once");
+
+	spiShift();
+	while((spcr & (1 << SPIE)) && spiFlag && count < 2000){
+		spiFlag = 0; /* cleared by the hardware on running the interrupt */
+		SPI_STC_vect();
+		spiShift();
+		count++;
+	}
+
+	check(!(spcr & (1 << SPIE)), "interrupt left turned on");
+	return count;
+}
+
+/*
+ * The tests
+ */
+static void checkTurnOn(void)
+{
+	int page, col, blank = 1;
+
+	initLcdScreen();
+	lcdTurnOn();
+	spiShift();
+
+	check(panel.on,                  "panel not turned on");
+	check(panel.chargePump == 0x14,  "charge pump not turned on");
+	check(panel.mux == 0x3f,         "panel not set to 64 rows");
+	check(panel.comPins == 0x12,     "row pins not set for a 128x64 panel");
+	check(panel.offset == 0,         "rows offset");
+	check(panel.startLine == 0,      "not starting at row 0");
+	check(!panel.inverse,            "panel inverted");
+	check(!panel.allOn,              "panel not showing its memory");
+	check(spcr & (1 << SPE),         "SPI not on");
+	check(spcr & (1 << MSTR),        "SPI not master");
+	check(PORTB & (1 << OLED_CS_BIT), "panel left selected");
+
+	for(page=0; page<8; page++){
+		for(col=0; col<128; col++){
+			if(panel.ram[page][col]){
+				blank = 0;
+			}
+		}
+	}
+	check(blank, "panel not blanked");
+}
+
+/* Sends framebuffer and checks the panel shows what the LCD did */
+static void checkFrame(const char* name)
+{
+	int      x, y, wrong = 0;
+	unsigned count;
+
+	lcdRepaint();
+	count = spiRunInterrupt();
+
+	check(panel.dataBytes == 1024,    "repaint was not one whole screen");
+	check(count == 1024,              "interrupt did not run once per byte");
+	check(PORTB & (1 << OLED_CS_BIT), "panel left selected after repaint");
+
+	for(y=0; y<64; y++){
+		for(x=0; x<128; x++){
+			if(panelPixel(x, y) != lcdPixel(x, y)){
+				wrong++;
+			}
+		}
+	}
+	if(wrong){
+		printf("%s: %d pixels differ from the LCD\n", name, wrong);
+		errors++;
+	}
+}
+
+/* Reads a plain (P1) PBM image of the whole screen */
+static int readScreen(const char* path, uint8_t image[64][128])
+{
+	FILE* f = fopen(path, "r");
+	int   c, width, height, x = 0, y = 0;
+	char  line[256];
+
+	if(f == NULL || fscanf(f, "P1 ") != 0){
+		return 0;
+	}
+	while((c = fgetc(f)) == '#'){
+		if(fgets(line, sizeof(line), f) == NULL){
+			break;
+		}
+	}
+	ungetc(c, f);
+	if(fscanf(f, "%d %d", &width, &height) != 2 || width != 128 || height != 64){
+		fclose(f);
+		return 0;
+	}
+	while(y < 64 && (c = fgetc(f)) != EOF){
+		if(c == '0' || c == '1'){
+			image[y][x] = c == '1';
+			if(++x == 128){
+				x = 0;
+				y++;
+			}
+		}
+	}
+	fclose(f);
+
+	return y == 64;
+}
+
+static void checkSplash(void)
+{
+	static uint8_t image[64][128];
+	int            x, y, wrong = 0;
+
+	if(!readScreen("assets/splash.pbm", image)){
+		check(0, "cannot read assets/splash.pbm (run from the top of the repository)");
+		return;
+	}
+
+	lcdShowSplash();
+	spiShift();
+
+	check(panel.dataBytes == 1024,    "splash was not one whole screen");
+	check(PORTB & (1 << OLED_CS_BIT), "panel left selected after the splash");
+
+	for(y=0; y<64; y++){
+		for(x=0; x<128; x++){
+			if(panelPixel(x, y) != image[y][x]){
+				wrong++;
+			}
+		}
+	}
+	if(wrong){
+		printf("splash: %d pixels differ from assets/splash.pbm\n", wrong);
+		errors++;
+	}
+}
+
+int main(void)
+{
+	uint16_t i;
+
+	checkTurnOn();
+	checkSplash();
+
+	/* Every byte different, so any byte out of place is seen */
+	for(i=0; i<1024; i++){
+		framebuffer[i] = (uint8_t)(i * 7 + (i >> 8) * 3 + 1);
+	}
+	checkFrame("pattern");
+
+	/* Some pixels and text, as the game draws them */
+	lcdClear();
+	lcdDrawPixel(0, 0);
+	lcdDrawPixel(127, 63);
+	lcdDrawPixel(5, 40);
+	lcdPrintText("Game Over", 2);
+	lcdPrintSmallText("score 42", 7, 3);
+	checkFrame("drawing");
+
+	printf("%s\n", errors ? "FAILED" : "ok");
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,113 @@
+#!/bin/sh
+#
+# optmatrix.sh - builds the firmware once for each of a set of
+# compiler option combinations and prints a table of the flash
+# and SRAM each one takes, so that the options used for the real
+# build can be chosen from figures rather than guesswork.
+#
+# Usage: tools/optmatrix.sh [outdir]   (from the top of the repository)
+#
+# Each firmware is left in outdir (default: optmatrix) named after
+# its options, e.g. optmatrix/O2-lto.elf. The speed of each may
+# then be compared by building with PROFILE=1, which also defines
+# PROFILE_FUNCTIONS (see profile.c): flash each in turn and the
+# cycles spent in lcdRepaint, gameLoop, lcdDrawSprite and so on
+# are printed over serial at the game over screen.
+#
+# The cycles/frame column comes from the attract mode statistics
+# (see attract.c): flash a firmware, let it play itself through
+# at least one game and save what it printed over serial next to
+# it, e.g. as optmatrix/O2-lto.log. The mean frame time from the
+# last "attract:" line there is shown in cycles, the column shows
+# "-" for any firmware without a log. Running the script again
+# fills in the column without losing the logs.
+#
+# ARDUINO_INC must be set to the directory holding the Arduino
+# core's headers (WProgram.h and friends). MCU and F_CPU may be
+# set for other boards (default: ATmega1280 at 16MHz).
+
+CC=${AVR_CC:-avr-gcc}
+SIZE=${AVR_SIZE:-avr-size}
+MCU=${MCU:-atmega1280}
+F_CPU=${F_CPU:-16000000UL}
+OUT=${1:-optmatrix}
+
+if [ -z "$ARDUINO_INC" ]; then
+	echo "$0: ARDUINO_INC must be set to the Arduino core's include directory" >&2
+	exit 1
+fi
+
+# name:options - one build per line
+CONFIGS="
+Os:-Os
+Os-lto:-Os -flto
+Os-prologues:-Os -mcall-prologues
+Os-lto-prologues:-Os -flto -mcall-prologues
+O2:-O2
+O2-lto:-O2 -flto
+O3:-O3
+O3-lto:-O3 -flto
+"
+
+COMMON="-mmcu=$MCU -DF_CPU=$F_CPU -std=gnu99 -I$ARDUINO_INC -ffunction-sections -fdata-sections"
+INSTRUMENT=""
+if [ -n "$PROFILE" ]; then
+	COMMON="$COMMON -DPROFILE_FUNCTIONS"
+	INSTRUMENT="-finstrument-functions"
+fi
+
+mkdir -p "$OUT"
+
+# The objects are built in a directory of their own which is emptied
+# before each build and removed however the script ends, so nothing
+# left by a failed (or interrupted) build can end up in another.
+OBJDIR=$(mktemp -d "${TMPDIR:-/tmp}/optmatrix.XXXXXX") || exit 1
+trap 'rm -rf "$OBJDIR"' EXIT
+trap 'exit 1' INT TERM
+
+printf "%-20s %8s %8s %8s %12s\n" "options" "flash" ".data" ".bss" "cycles/frame"
+
+echo "$CONFIGS" | while IFS=: read -r name flags; do
+	[ -n "$name" ] || continue
+
+	rm -f "$OBJDIR"/*.o "$OUT/$name.elf"
+
+	objs=""
+	failed=""
+	for src in src/*.c; do
+		obj="$OBJDIR/$(basename "$src" .c).o"
+
+		# Only the game's own code is instrumented when profiling
+		case "$src" in
+			src/main.c|src/lcd.c|src/input.c|src/script.c) extra=$INSTRUMENT ;;
+			*)                                             extra="" ;;
+		esac
+
+		if ! $CC $COMMON $flags $extra -c -o "$obj" "$src"; then
+			failed=1
+			break
+		fi
+		objs="$objs $obj"
+	done
+
+	if [ -n "$failed" ] || ! $CC -mmcu=$MCU $flags -Wl,--gc-sections -o "$OUT/$name.elf" $objs; then
+		printf "%-20s %8s\n" "$name" "failed"
+		continue
+	fi
+
+	# The mean frame time (in microseconds) of the last attract
+	# mode game in this firmware's log, if there is one
+	mean=""
+	if [ -f "$OUT/$name.log" ]; then
+		mean=$(tr -d '\r' < "$OUT/$name.log" | sed -n 's/^attract: .* mean \([0-9]*\)us.*/\1/p' | tail -n 1)
+	fi
+
+	$SIZE -A "$OUT/$name.elf" | awk -v name="$name" -v mean="$mean" -v hz="${F_CPU%UL}" '
+		$1 == ".text" { text = $2 }
+		$1 == ".data" { data = $2 }
+		$1 == ".bss"  { bss  = $2 }
+		END {
+			cycles = mean == "" ? "-" : sprintf("%d", mean * (hz / 1000000))
+			printf "%-20s %8d %8d %8d %12s\n", name, text + data, data, bss, cycles
+		}'
+done
@@ -0,0 +1,480 @@
+/*
+  pbm2c.c - this is a host (PC) program, not part of the
+  firmware. It converts 1-bit art stored as PBM images into
+  the C look up tables used by the firmware, so that the
+  bitmaps never have to be typed out in hex by hand and can
+  be stored in whichever layout is fastest to draw.
+
+  PNG art can be converted to PBM first with netpbm, e.g.
+
+    pngtopnm alien.png | ppmtopgm | pamthreshold | pamtopnm > alien.pbm
+
+  The image is split into cells (one cell per sprite or font
+  character) placed side by side from left to right, each
+  cell being -w pixels wide and 8 pixels tall. A black pixel
+  in the image is a lit pixel on the LCD. Full screen images
+  are instead output with the pages layout.
+
+  Usage:
+
+    pbm2c -n NAME [-f rows|columns|shifted|pages|proportional]
+          [-w WIDTH] [-m] [-u] [-z] [-l LABELS] [-a FIRST]
+          image.pbm > table.c
+
+    -n  name of the table to output
+    -f  the layout of the table:
+          rows     one byte per row of each cell, bit 0 being
+                   the left-most pixel (cells must be 8 wide),
+          columns  one byte per column of each cell, i.e. the
+                   same vertical 8 pixel layout as the LCD
+                   (and framebuffer) pages,
+          shifted  as columns, but with 8 copies of each cell
+                   pre-shifted down by 0 to 7 pixels, as 2 bytes
+                   per column (the upper page, then the page
+                   below) so a cell may be drawn at any height
+                   without shifting at runtime,
+          pages    the whole image (any multiple of 8 pixels
+                   tall) in the frame buffer's layout, i.e.
+                   each page of 8 rows in turn as one byte
+                   per column,
+          proportional  as columns, but any blank columns
+                   either side of each cell are left out. A
+                   second table, NAME_INDEX, gives each cell's
+                   offset into the first table and width as
+                   (offset << 3) | width (an empty cell is
+                   given (WIDTH+1)/2 blank columns).
+    -w  width of each cell (default 8)
+    -m  mirror each cell (or the whole image for pages) left
+        to right
+    -u  upside down, bit 7 (rather than bit 0) is the top row
+        (and for pages, the last page is the top of the image)
+    -z  compress the table (see src/rle.c for the format)
+    -l  a string with one character per cell used to label
+        the cells in the output
+    -a  label the cells as ASCII characters, starting with
+        character code FIRST
+
+  A one line size report for the table is written to stderr.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FORMAT_ROWS    0
+#define FORMAT_COLUMNS 1
+#define FORMAT_SHIFTED 2
+#define FORMAT_PAGES   3
+#define FORMAT_PROP    4
+
+/* run kinds, as decoded by src/rle.c */
+#define RLE_LITERAL    0x00
+#define RLE_ZEROS      0x40
+#define RLE_ONES       0x80
+#define RLE_REPEAT     0xc0
+#define RLE_MAX_RUN    64
+
+static int            width, height;
+static unsigned char* pixels; /* one byte per pixel, 1 for lit */
+
+static int readNumber(FILE* f)
+{
+	int c, n = 0;
+
+	/* skip white space and comments */
+	do{
+		c = fgetc(f);
+		if(c == '#'){
+			while(c != '\n' && c != EOF){
+				c = fgetc(f);
+			}
+		}
+	}while(c == ' ' || c == '\t' || c == '\r' || c == '\n');
+
+	if(c < '0' || c > '9'){
+		return -1;
+	}
+	while(c >= '0' && c <= '9'){
+		n = n*10 + (c - '0');
+		c = fgetc(f);
+	}
+	return n;
+}
+
+static int readPbm(const char* path)
+{
+	FILE* f;
+	int   magic, x, y, c, bit;
+
+	f = fopen(path, "rb");
+	if(f == NULL){
+		perror(path);
+		return 0;
+	}
+
+	if(fgetc(f) != 'P' || ((magic = fgetc(f)) != '1' && magic != '4')){
+		fprintf(stderr, "%s: not a PBM image\n", path);
+		fclose(f);
+		return 0;
+	}
+
+	width  = readNumber(f);
+	height = readNumber(f);
+	if(width <= 0 || height <= 0){
+		fprintf(stderr, "%s: bad image size\n", path);
+		fclose(f);
+		return 0;
+	}
+
+	pixels = calloc(width * height, 1);
+
+	for(y=0; y<height; y++){
+		if(magic == '1'){
+			/* plain PBM, one '0' or '1' per pixel */
+			for(x=0; x<width; x++){
+				do{
+					c = fgetc(f);
+				}while(c != '0' && c != '1' && c != EOF);
+				pixels[y*width + x] = (c == '1');
+			}
+		}else{
+			/* raw PBM, each row packed into bytes MSB first */
+			for(x=0; x<width; x+=8){
+				c = fgetc(f);
+				for(bit=0; bit<8 && x+bit<width; bit++){
+					pixels[y*width + x+bit] = (c >> (7-bit)) & 1;
+				}
+			}
+		}
+	}
+
+	fclose(f);
+	return 1;
+}
+
+/*
+ * Returns the byte for column 'x' of the 8 rows starting at 'y0',
+ * bit 0 is the top row unless upside down was asked for.
+ */
+static unsigned char pageByte(int y0, int x, int upsideDown)
+{
+	unsigned char value = 0;
+	int           row;
+
+	for(row=0; row<8; row++){
+		if(pixels[(y0+row)*width + x]){
+			value |= 1 << (upsideDown ? 7-row : row);
+		}
+	}
+	return value;
+}
+
+/* As pageByte, for column 'col' of the cell starting at 'x0' */
+static unsigned char columnByte(int x0, int col, int upsideDown)
+{
+	return pageByte(0, x0 + col, upsideDown);
+}
+
+static unsigned char rowByte(int x0, int row, int mirror)
+{
+	unsigned char value = 0;
+	int           col;
+
+	for(col=0; col<8; col++){
+		if(pixels[row*width + x0 + col]){
+			value |= 1 << (mirror ? 7-col : col);
+		}
+	}
+	return value;
+}
+
+static void emitByte(unsigned value, int n)
+{
+	printf(n == 0 ? "\t0x%02x" : ", 0x%02x", value);
+}
+
+static void emitLabel(const char* labels, int ascii, int cell)
+{
+	if(labels != NULL && cell < (int)strlen(labels)){
+		printf("   /*  %c  */", labels[cell]);
+	}else if(ascii >= 0){
+		printf("   /*  %c  */", ascii + cell);
+	}
+}
+
+/* Returns the length of the run of equal bytes starting at data[i] */
+static int runLength(const unsigned char* data, int i, int length)
+{
+	int n = 1;
+
+	while(i+n < length && data[i+n] == data[i] && n < RLE_MAX_RUN){
+		n++;
+	}
+	return n;
+}
+
+/*
+ * Compresses 'length' bytes of data into out (which must have
+ * room for length + length/RLE_MAX_RUN + 1 bytes, the worst
+ * case) and returns the compressed length.
+ */
+static int compress(const unsigned char* data, int length, unsigned char* out)
+{
+	int i = 0, n = 0, run, literal = -1; /* index of the open literal's control byte */
+
+	while(i < length){
+		run = runLength(data, i, length);
+
+		if(data[i] == 0x00 || data[i] == 0xff || run >= 3){
+			/* runs of clear or set bytes cost only the control
+			 * byte, any other byte costs 2 so is only worth a
+			 * run once it is repeated 3 times */
+			if(data[i] == 0x00){
+				out[n++] = RLE_ZEROS  | (run-1);
+			}else if(data[i] == 0xff){
+				out[n++] = RLE_ONES   | (run-1);
+			}else{
+				out[n++] = RLE_REPEAT | (run-1);
+				out[n++] = data[i];
+			}
+			i      += run;
+			literal = -1;
+		}else{
+			if(literal < 0 || (out[literal] & 0x3f) == RLE_MAX_RUN-1){
+				literal = n;
+				out[n++] = RLE_LITERAL;
+			}else{
+				out[literal]++;
+			}
+			out[n++] = data[i++];
+		}
+	}
+	return n;
+}
+
+/* Prints the table for a whole image in the pages layout */
+static int emitPages(int mirror, int upsideDown, int compressed)
+{
+	unsigned char* data;
+	unsigned char* out;
+	int            page, pages = height / 8, x, i, length;
+
+	length = width * pages;
+	data   = malloc(length);
+	out    = malloc(length + length/RLE_MAX_RUN + 1);
+
+	for(page=0; page<pages; page++){
+		for(x=0; x<width; x++){
+			data[page*width + x] = pageByte((upsideDown ? pages-1-page : page) * 8,
+			                                mirror ? width-1-x : x, upsideDown);
+		}
+	}
+
+	if(compressed){
+		length = compress(data, length, out);
+	}else{
+		memcpy(out, data, length);
+	}
+
+	for(i=0; i<length; i++){
+		emitByte(out[i], i % 16);
+		printf(i+1 == length ? "\n" : (i % 16 == 15 ? ",\n" : ""));
+	}
+
+	free(data);
+	free(out);
+	return length;
+}
+
+/*
+ * Prints the tables for a proportional font (see above), returning
+ * the exit status for main.
+ */
+static int emitProportional(const char* name, int cellWidth, int mirror, int upsideDown,
+                            const char* labels, int ascii)
+{
+	int cell, cells = width / cellWidth, first, last, i, col, offset = 0;
+	int* index = malloc(cells * sizeof(int));
+
+	printf("volatile const unsigned char __attribute((__progmem__)) %s[]={\n", name);
+	for(cell=0; cell<cells; cell++){
+		/* find the left and right-most columns with any pixels */
+		first = cellWidth;
+		last  = -1;
+		for(i=0; i<cellWidth; i++){
+			if(columnByte(cell*cellWidth, i, upsideDown) != 0){
+				if(first == cellWidth){
+					first = i;
+				}
+				last = i;
+			}
+		}
+		if(last < 0){
+			first = 0;
+			last  = (cellWidth+1)/2 - 1;
+		}
+		if(last - first + 1 > 7 || offset > 0x1fff){
+			fprintf(stderr, "%s: cells too wide or too many for the index\n", name);
+			return 1;
+		}
+
+		for(i=0; i<=last-first; i++){
+			col = mirror ? last-i : first+i;
+			emitByte(columnByte(cell*cellWidth, col, upsideDown), i);
+		}
+		printf("%s", cell+1 < cells ? "," : " ");
+		emitLabel(labels, ascii, cell);
+		printf("\n");
+
+		index[cell] = (offset << 3) | (last - first + 1);
+		offset     += last - first + 1;
+	}
+	printf("};\n\n");
+
+	printf("volatile const unsigned short __attribute((__progmem__)) %s_INDEX[]={\n", name);
+	for(cell=0; cell<cells; cell++){
+		printf("%s0x%04x%s", cell % 8 == 0 ? "\t" : " ", index[cell],
+		       cell+1 == cells ? "\n" : (cell % 8 == 7 ? ",\n" : ","));
+	}
+	printf("};\n");
+
+	fprintf(stderr, "%-16s %3d cells %5d bytes (and %d bytes of index)\n",
+	        name, cells, offset, cells * 2);
+	free(index);
+	free(pixels);
+	return 0;
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: pbm2c -n NAME [-f rows|columns|shifted|pages|proportional] "
+	                "[-w WIDTH] [-m] [-u] [-z] [-l LABELS] [-a FIRST] image.pbm\n");
+	exit(1);
+}
+
+int main(int argc, char** argv)
+{
+	const char* name   = NULL;
+	const char* labels = NULL;
+	const char* path   = NULL;
+	int         format = FORMAT_COLUMNS;
+	int         cellWidth = 8, mirror = 0, upsideDown = 0, compressed = 0, ascii = -1;
+	int         i, cell, cells, col, shift, n, bytes = 0;
+	unsigned    word;
+
+	for(i=1; i<argc; i++){
+		if(strcmp(argv[i], "-n") == 0 && i+1 < argc){
+			name = argv[++i];
+		}else if(strcmp(argv[i], "-f") == 0 && i+1 < argc){
+			i++;
+			if     (strcmp(argv[i], "rows"   ) == 0) format = FORMAT_ROWS;
+			else if(strcmp(argv[i], "columns") == 0) format = FORMAT_COLUMNS;
+			else if(strcmp(argv[i], "shifted") == 0) format = FORMAT_SHIFTED;
+			else if(strcmp(argv[i], "pages"  ) == 0) format = FORMAT_PAGES;
+			else if(strcmp(argv[i], "proportional") == 0) format = FORMAT_PROP;
+			else usage();
+		}else if(strcmp(argv[i], "-w") == 0 && i+1 < argc){
+			cellWidth = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "-l") == 0 && i+1 < argc){
+			labels = argv[++i];
+		}else if(strcmp(argv[i], "-a") == 0 && i+1 < argc){
+			ascii = atoi(argv[++i]);
+		}else if(strcmp(argv[i], "-m") == 0){
+			mirror = 1;
+		}else if(strcmp(argv[i], "-u") == 0){
+			upsideDown = 1;
+		}else if(strcmp(argv[i], "-z") == 0){
+			compressed = 1;
+		}else if(argv[i][0] != '-' && path == NULL){
+			path = argv[i];
+		}else{
+			usage();
+		}
+	}
+
+	if(name == NULL || path == NULL || cellWidth <= 0){
+		usage();
+	}
+	if(!readPbm(path)){
+		return 1;
+	}
+
+	if(format == FORMAT_PAGES){
+		if(height % 8 != 0){
+			fprintf(stderr, "%s: image must be a multiple of 8 pixels tall\n", path);
+			return 1;
+		}
+		printf("volatile const unsigned char __attribute((__progmem__)) %s[]={\n", name);
+		bytes = emitPages(mirror, upsideDown, compressed);
+		printf("};\n");
+
+		fprintf(stderr, "%-16s %3d pages %5d bytes", name, height / 8, bytes);
+		if(compressed){
+			fprintf(stderr, " (from %d)", width * height / 8);
+		}
+		fprintf(stderr, "\n");
+		free(pixels);
+		return 0;
+	}
+	if(compressed){
+		fprintf(stderr, "-z is only supported for the pages layout\n");
+		return 1;
+	}
+	if(format == FORMAT_PROP){
+		/* only the top 8 rows are used, as with the other layouts */
+		if(height < 8 || width % cellWidth != 0){
+			fprintf(stderr, "%s: image must be at least 8 pixels tall and a whole "
+			                "number of %d pixel wide cells\n", path, cellWidth);
+			return 1;
+		}
+		return emitProportional(name, cellWidth, mirror, upsideDown, labels, ascii);
+	}
+	if(height != 8 || width % cellWidth != 0 || (format == FORMAT_ROWS && cellWidth != 8)){
+		fprintf(stderr, "%s: image must be 8 pixels tall and a whole number of "
+		                "%d pixel wide cells\n", path, format == FORMAT_ROWS ? 8 : cellWidth);
+		return 1;
+	}
+	cells = width / cellWidth;
+
+	printf("volatile const unsigned char __attribute((__progmem__)) %s[]={\n", name);
+	for(cell=0; cell<cells; cell++){
+		n = 0;
+
+		if(format == FORMAT_ROWS){
+			for(i=0; i<8; i++){
+				emitByte(rowByte(cell*cellWidth, i, mirror), n++);
+			}
+		}else{
+			for(shift=0; shift<(format == FORMAT_SHIFTED ? 8 : 1); shift++){
+				for(i=0; i<cellWidth; i++){
+					col  = mirror ? cellWidth-1-i : i;
+					word = (unsigned)columnByte(cell*cellWidth, col, upsideDown) << shift;
+					if(format == FORMAT_SHIFTED){
+						/* a new line for each shift keeps it readable */
+						if(i == 0 && shift > 0){
+							printf(",\n");
+							n = 0;
+						}
+						emitByte(word & 0xff, n++);
+						emitByte(word >> 8,   n++);
+						bytes += 2;
+					}else{
+						emitByte(word, n++);
+						bytes++;
+					}
+				}
+			}
+		}
+		if(format == FORMAT_ROWS){
+			bytes += 8;
+		}
+
+		printf("%s", cell+1 < cells ? "," : (labels != NULL ? " " : ""));
+		emitLabel(labels, -1, cell);
+		printf("\n");
+	}
+	printf("};\n");
+
+	fprintf(stderr, "%-16s %3d cells %5d bytes\n", name, cells, bytes);
+	free(pixels);
+	return 0;
+}
@@ -0,0 +1,109 @@
+/*
+  ringtest.c - this is a host (PC) program, not part of the
+  firmware. It checks src/ring.h by having one thread put a
+  long run of bytes into a ring while another takes them out,
+  as an interrupt and the main loop would on the AVR, and
+  checking every byte comes out once and in order.
+
+  Each of the ring sizes the firmware may use (1 to 128) is
+  tried in turn. The threads never wait for each other beyond
+  giving up the processor on a full or empty ring (so this
+  also works on a single processor), so the two sides are
+  interleaved as unpredictably as the host allows.
+
+  Note that this relies on the host not reordering one thread's
+  writes as seen by another, which holds on x86 (as it does on
+  the AVR) but not on every processor, e.g. ARM.
+
+  Usage:
+
+    cc -O2 -pthread -Isrc -o ringtest tools/ringtest.c
+    ./ringtest [bytes per size]
+
+  Prints "ok" and exits with 0 if every byte arrived intact.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ring.h"
+
+static uint8_t       data1[1],  data2[2],  data4[4],   data8[8];
+static uint8_t       data16[16], data32[32], data64[64], data128[128];
+
+static Ring          rings[] = {
+	RING_INIT(data1),  RING_INIT(data2),  RING_INIT(data4),  RING_INIT(data8),
+	RING_INIT(data16), RING_INIT(data32), RING_INIT(data64), RING_INIT(data128)
+};
+
+static unsigned long count = 1000000UL;
+
+/* The byte expected at each position, this repeats only every
+ * 64K bytes so that losing a whole ring's worth is still seen */
+#define PATTERN(i)   ((uint8_t)((i) ^ ((i) >> 8)))
+
+static void* producer(void* arg)
+{
+	Ring*         ring = arg;
+	unsigned long i;
+
+	for(i=0; i<count; i++){
+		while(!ringPut(ring, PATTERN(i))){
+			sched_yield(); /* ring full, let the consumer run */
+		}
+	}
+
+	return NULL;
+}
+
+static unsigned long consume(Ring* ring)
+{
+	unsigned long i, errors = 0;
+	uint8_t       value;
+
+	for(i=0; i<count; i++){
+		while(!ringGet(ring, &value)){
+			sched_yield(); /* ring empty, let the producer run */
+		}
+		if(value != PATTERN(i)){
+			errors++;
+		}
+		if(ringCount(ring) > ring->mask + 1){
+			errors++;
+		}
+	}
+
+	/* Anything left over would mean a byte was put in twice */
+	if(ringGet(ring, &value)){
+		errors++;
+	}
+
+	return errors;
+}
+
+int main(int argc, char** argv)
+{
+	pthread_t     thread;
+	unsigned long errors, total = 0;
+	unsigned int  i;
+
+	if(argc > 1){
+		count = strtoul(argv[1], NULL, 10);
+	}
+
+	for(i=0; i<sizeof(rings)/sizeof(rings[0]); i++){
+		if(pthread_create(&thread, NULL, producer, &rings[i]) != 0){
+			fprintf(stderr, "ringtest: cannot start thread\n");
+			return 2;
+		}
+		errors = consume(&rings[i]);
+		pthread_join(thread, NULL);
+
+		printf("size %3u: %lu bytes, %lu errors\n", rings[i].mask + 1, count, errors);
+		total += errors;
+	}
+
+	printf("%s\n", total ? "FAILED" : "ok");
+	return total ? 1 : 0;
+}
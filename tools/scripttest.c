@@ -0,0 +1,231 @@
+/*
+  scripttest.c - this is a host (PC) program, not part of the
+  firmware. It runs src/script.c with the scripts in src/data.c
+  frame by frame next to a copy of the hard-coded march and
+  fire countdown that gameLoop had before the scripts, and
+  checks the aliens move and fire just as they used to.
+
+  The two are not in step frame for frame, for reasons which
+  are part of the design rather than mistakes:
+
+    * gameLoop runs the march script before drawing the aliens,
+      where the old code moved them after, so each frame the
+      scripted aliens are drawn where the old ones would be
+      drawn the frame after.
+    * The fire script waits before it fires, where the old
+      countdown fired as it reached 0, so each shot comes a
+      frame later - and a shot due on the frame the player
+      loses a life is lost as the script is restarted.
+
+  It also checks, with scripts of its own, that repeats run the
+  right number of times and that a script which never waits is
+  stopped after SCRIPT_MAX_STEPS instructions a frame.
+
+  Usage:
+
+    cc -O2 -Wno-attributes -Itools/host -Isrc -o scripttest \
+      tools/scripttest.c src/script.c src/data.c
+    ./scripttest
+
+  Prints "ok" and exits with 0 if every check passed.
+*/
+#include <stdio.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include "gamedefs.h"
+#include "script.h"
+
+extern volatile const unsigned char __attribute__((__progmem__)) MARCH_SCRIPT[];
+extern volatile const unsigned char __attribute__((__progmem__)) FIRE_SCRIPT[];
+
+#define FRAMES      400
+#define ALIENS      (ROW1_ENEMY_COUNT + ROW2_ENEMY_COUNT)
+
+/* Frames on which the player is made to lose a life */
+#define LIFE_LOST_1 37
+#define LIFE_LOST_2 123
+
+/* Where each alien was drawn and whether any fired, each frame */
+typedef struct {
+	int     x[ALIENS], y[ALIENS];
+	uint8_t fired;
+	uint8_t landed; /* an alien reached the bottom, the game would be over */
+} Frame;
+
+static Frame          oldFrames[FRAMES];
+static Frame          newFrames[FRAMES];
+static unsigned long  errors;
+
+/* Works out where each alien is drawn, as gameLoop does, and
+ * returns how many of them are touching an edge */
+static uint8_t drawAliens(Frame* frame, float x, float y)
+{
+	uint8_t i, edges = 0;
+
+	for(i=0; i<ALIENS; i++){
+		if(i < ROW1_ENEMY_COUNT){
+			frame->x[i] = (int)(x + ALIEN_BETWEEN_OFFSET*i);
+			frame->y[i] = (int)(y + 0);
+		}else{
+			frame->x[i] = (int)(x + 9 + ALIEN_BETWEEN_OFFSET*(i - ROW1_ENEMY_COUNT));
+			frame->y[i] = (int)(y + ALIEN_HEIGHT);
+		}
+
+		if(frame->x[i] <= 0 || frame->x[i] + ALIEN_WIDTH >= SCREEN_WIDTH){
+			edges++;
+		}
+		if(frame->y[i] + ALIEN_HEIGHT >= SCREEN_HEIGHT){
+			frame->landed = 1;
+		}
+	}
+
+	return edges;
+}
+
+/* gameLoop as it was before the scripts, where each alien
+ * touching an edge turned the whole formation around */
+static void runOld(void)
+{
+	float    x = 10.0f, y = 0.0f, dx = 0.5f;
+	uint8_t  wait = ENEMY_WAIT_BETWEEN_FIRE;
+	uint8_t  edges;
+	unsigned k;
+
+	for(k=0; k<FRAMES; k++){
+		if(k == LIFE_LOST_1 || k == LIFE_LOST_2){
+			wait = ENEMY_WAIT_BETWEEN_FIRE;
+		}
+
+		if(wait > 0){
+			wait--;
+			if(wait == 0){
+				oldFrames[k].fired = 1;
+				wait = ENEMY_WAIT_BETWEEN_FIRE;
+			}
+		}
+
+		edges = drawAliens(&oldFrames[k], x, y);
+		while(edges--){
+			dx *= -1.2f;
+			y  += ALIEN_INCREASE_Y_BY;
+		}
+
+		x += dx;
+	}
+}
+
+/* gameLoop as it is now */
+static void runNew(void)
+{
+	Formation    formation = { 10.0f, 0.0f, 0.0f, 0, 0 };
+	ScriptEntity march, fire;
+	unsigned     k;
+
+	scriptStart(&march, (const unsigned char*)MARCH_SCRIPT);
+	scriptStart(&fire,  (const unsigned char*)FIRE_SCRIPT );
+
+	for(k=0; k<FRAMES; k++){
+		if(k == LIFE_LOST_1 || k == LIFE_LOST_2){
+			scriptStart(&fire, (const unsigned char*)FIRE_SCRIPT);
+		}
+
+		scriptRun(&march, &formation);
+		scriptRun(&fire,  &formation);
+
+		newFrames[k].fired = formation.fire;
+		formation.fire     = 0;
+		formation.hitEdge  = drawAliens(&newFrames[k], formation.x, formation.y) > 0;
+	}
+}
+
+static void check(int test, const char* what, unsigned frame)
+{
+	if(!test){
+		printf("frame %3u: %s\n", frame, what);
+		errors++;
+	}
+}
+
+static void compareMarch(void)
+{
+	unsigned k, i, bounces = 0;
+
+	for(k=0; k+1<FRAMES && !oldFrames[k+1].landed; k++){
+		for(i=0; i<ALIENS; i++){
+			check(newFrames[k].x[i] == oldFrames[k+1].x[i] &&
+			      newFrames[k].y[i] == oldFrames[k+1].y[i], "aliens not where they used to be", k);
+		}
+		if(k > 0 && newFrames[k].y[0] != newFrames[k-1].y[0]){
+			bounces++;
+		}
+	}
+
+	/* Make sure the march got as far as a few turns */
+	check(bounces >= 3, "aliens never turned around", k);
+	printf("march: %u frames compared, %u turns\n", k, bounces);
+}
+
+static void compareFire(void)
+{
+	unsigned k, shots = 0;
+
+	for(k=1; k<FRAMES; k++){
+		if(newFrames[k].fired){
+			check(oldFrames[k-1].fired, "fired when it used not to", k);
+			shots++;
+		}
+		if(oldFrames[k-1].fired && k != LIFE_LOST_1 && k != LIFE_LOST_2){
+			check(newFrames[k].fired, "did not fire when it used to", k);
+		}
+	}
+
+	printf("fire: %u shots compared\n", shots);
+}
+
+/* Marches then jumps back, and so never waits */
+static const unsigned char __attribute__((__progmem__)) RUNAWAY_SCRIPT[] = {
+	/* 0 */ SCRIPT_MARCH(),
+	/* 1 */ SCRIPT_JUMP(0)
+};
+
+/* Marches 3 times a frame */
+static const unsigned char __attribute__((__progmem__)) REPEAT_SCRIPT[] = {
+	/* 0 */ SCRIPT_MARCH(),
+	/* 1 */ SCRIPT_REPEAT(2, 0),
+	/* 4 */ SCRIPT_WAIT(1),
+	/* 6 */ SCRIPT_JUMP(0)
+};
+
+/* Checks the script marches expected times in each of a few frames */
+static void countMarches(const unsigned char* script, unsigned expected, const char* what)
+{
+	Formation    formation = { 0.0f, 0.0f, 1.0f, 0, 0 };
+	ScriptEntity entity;
+	unsigned     k;
+	float        last;
+
+	scriptStart(&entity, script);
+
+	for(k=0; k<10; k++){
+		last = formation.x;
+		scriptRun(&entity, &formation);
+		check((unsigned)(formation.x - last) == expected, what, k);
+	}
+}
+
+int main(void)
+{
+	runOld();
+	runNew();
+
+	compareMarch();
+	compareFire();
+
+	/* Each frame the runaway script gets through SCRIPT_MAX_STEPS
+	 * instructions, half of which are marches */
+	countMarches(RUNAWAY_SCRIPT, SCRIPT_MAX_STEPS / 2, "runaway script not stopped");
+	countMarches(REPEAT_SCRIPT,  3,                    "repeat ran the wrong number of times");
+
+	printf("%s\n", errors ? "FAILED" : "ok");
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+#!/bin/sh
+#
+# sramreport.sh - prints how much SRAM each module of the firmware
+# takes up in .data, .rodata and .bss, and how much is left for the
+# stack.
+#
+# Usage: sramreport.sh firmware.elf module.o [module.o ...]
+#
+# The object files are those produced when building the firmware
+# (e.g. main.o, lcd.o, data.o), the elf is the linked firmware. The
+# 'stack headroom' is what is left between the end of .bss and the
+# top of SRAM - compare it with the "bytes never used" reported by
+# stackReport() at runtime to see how close the stack actually came.
+#
+# Any 'common' symbols (uninitialised globals, when compiled with
+# -fcommon as older avr-gcc does by default) are only placed in .bss
+# at link time, so these are counted from the symbol table and added
+# to the module's .bss.
+#
+# Constant tables not placed in program memory (PROGMEM) end up in
+# .rodata, which on the AVR is copied into SRAM at reset along with
+# .data - the linker puts it inside the firmware's .data, so the
+# total's .data already includes it.
+#
+# SRAM_SIZE may be set for other devices (default: ATmega1280/2560).
+
+SIZE=${AVR_SIZE:-avr-size}
+NM=${AVR_NM:-avr-nm}
+SRAM_SIZE=${SRAM_SIZE:-8192}
+
+if [ $# -lt 2 ]; then
+	echo "usage: $0 firmware.elf module.o [module.o ...]" >&2
+	exit 1
+fi
+
+ELF=$1
+shift
+
+printf "%-16s %8s %8s %8s %8s\n" "module" ".data" ".rodata" ".bss" "sram"
+for obj in "$@"; do
+	common=$($NM -S -t d "$obj" | awk '$3 == "C" { sum += $2 } END { print sum + 0 }')
+	$SIZE -A "$obj" | awk -v name="$(basename "$obj")" -v common="$common" '
+		$1 ~ /^\.data/   { data   += $2 }
+		$1 ~ /^\.rodata/ { rodata += $2 }
+		$1 ~ /^\.bss/    { bss    += $2 }
+		END {
+			bss += common
+			printf "%-16s %8d %8d %8d %8d\n", name, data, rodata, bss, data + rodata + bss
+		}'
+done
+
+$SIZE -A "$ELF" | awk -v sram="$SRAM_SIZE" '
+	$1 == ".data" { data = $2 }
+	$1 == ".bss"  { bss  = $2 }
+	END {
+		printf "%-16s %8d %8s %8d %8d\n", "total", data, "-", bss, data + bss
+		printf "stack headroom: %d bytes\n", sram - data - bss
+	}'